@@ -79,12 +79,26 @@ public:
 	// returns the type of the items in the property.
 	virtual Type *ItemType() const = 0;
 
+	// Function: ItemData
+	// The items as a contiguous block of <ItemType>, or NULL if
+	// they are not stored that way (or there are none).
+	//
+	// As with <RefData>, the items of *out* are returned if it is given,
+	// otherwise those of *in*, which must not be written through the result.
+	//
+	// The default implementation returns NULL.
+	virtual void *ItemData(const void *in, void *out) const;
+
 	// Function: Serialize
 	// Serializes the entire array/vector.
 	//
 	// If the property is <Resizable> then a [size=%d] <SerializationTag::AttributeTag> 
 	// will be emitted here.
 	//
+	// Primitive items with <ItemData> are passed to <Serializer.SerializeArray>
+	// and <Deserializer.DeserializeArray> at once, others go one at a time
+	// through <SerializeItem>.
+	//
 	// Implements <Property::Serialize>
 	void Serialize(const void *in, void *out, Reflector &reflector) const; // virtual
 };
@@ -0,0 +1,101 @@
+#ifndef REFLECT_BUFFEREDINPUTSTREAM_H_
+#define REFLECT_BUFFEREDINPUTSTREAM_H_
+
+#include <reflect/InputStream.h>
+#include <reflect/config/config.h>
+
+namespace reflect {
+
+// Class: BufferedInputStream
+//
+// An <InputStream> which reads ahead from another stream (or
+// wraps a block of memory) and exposes what it has read as a
+// window of contiguous bytes.
+//
+// Tokenizers look at the window with <Peek>/<Window>/<Available>,
+// advance through it with <Consume>, and call <Fill> when they
+// need more, so scanning costs no virtual call per byte.
+class ReflectExport(reflect) BufferedInputStream : public InputStream
+{
+public:
+	using InputStream::size_type;
+
+	enum { DefaultCapacity = 512, NoReadAhead = 0 };
+
+	// Constructor: BufferedInputStream
+	// An empty stream.
+	BufferedInputStream();
+
+	// Constructor: BufferedInputStream(InputStream &, size_type)
+	// Buffers reads from *source*, *capacity* bytes at a time.
+	//
+	// With a capacity of <NoReadAhead> only the bytes asked for by <Fill>
+	// are read, so *source* is never read past the <Window>.
+	BufferedInputStream(InputStream &source, size_type capacity = DefaultCapacity);
+
+	// Constructor: BufferedInputStream(const void *, size_type)
+	// A window over *size* bytes of memory, nothing is copied.
+	BufferedInputStream(const void *data, size_type size);
+
+	~BufferedInputStream();
+
+	// Function: Window
+	// The unconsumed bytes already read.
+	const char *Window() const { return mCursor; }
+
+	// Function: Available
+	// The number of bytes in the <Window>.
+	size_type Available() const { return size_type(mEnd - mCursor); }
+
+	// Function: Consume
+	// Advances the <Window> by *nbytes*, which must be at most <Available>.
+	void Consume(size_type nbytes) { mCursor += nbytes; }
+
+	// Function: Fill
+	// Reads from the source until at least *wanted* bytes are
+	// <Available> or the source is exhausted.
+	//
+	// Returns:
+	//    <Available>
+	size_type Fill(size_type wanted = 1);
+
+	// Function: Peek
+	// The next byte, or -1 at the end of the stream.
+	int Peek()
+	{
+		return (mCursor != mEnd || Fill())
+			? int(static_cast<unsigned char>(*mCursor))
+			: -1;
+	}
+
+	// Function: Resident
+	// True when the whole input is in memory (no source stream), so
+	// pointers into the <Window> stay valid for the life of the stream.
+	bool Resident() const { return 0 == mSource; }
+
+	// Function: Read
+	// Copies out of the <Window> first, then reads directly from the source.
+	/*virtual*/ size_type Read(void *buffer, size_type bufmax);
+
+protected:
+	// Function: SetMemory
+	// Replaces the window with *size* bytes of memory, for subclasses
+	// which acquire their memory after construction.
+	void SetMemory(const void *data, size_type size);
+
+private:
+	BufferedInputStream(const BufferedInputStream &);
+	void operator =(const BufferedInputStream &);
+
+	InputStream *mSource;
+	char *mBuffer;
+	size_type mCapacity;
+	bool mReadAhead;
+	const char *mCursor;
+	const char *mEnd;
+	char mInlineBuffer[DefaultCapacity];
+};
+
+}
+
+#endif
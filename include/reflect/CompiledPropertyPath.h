@@ -0,0 +1,110 @@
+#ifndef REFLECT_COMPILEDPROPERTYPATH_H_
+#define REFLECT_COMPILEDPROPERTYPATH_H_
+
+#include <reflect/PropertyPath.h>
+#include <reflect/string/SharedString.h>
+#include <reflect/string/String.h>
+#include <reflect/Variant.h>
+#include <reflect/config/config.h>
+#include <vector>
+
+namespace reflect {
+
+class Persistent;
+class PersistentClass;
+
+// Class: CompiledPropertyPath
+//
+// A property path parsed once and resolved against a root class,
+// for evaluating the same path against many objects.
+//
+// <Compile> splits the path into steps and looks up each property,
+// array index and map key for the classes the path is expected to
+// pass through.  <Resolve> then walks an object with those cached
+// properties, without tokenizing the path or searching property maps.
+//
+// A step reached with an object of a different class than the one it
+// was compiled for is looked up by name, as <PropertyPath.Advance> would.
+//
+// Example:
+// (code)
+// CompiledPropertyPath path;
+// path.Compile("links[1].map{3}", TypeOf<Node>());
+//
+// PropertyPath result;
+// for(each node)
+//     if(path.Resolve(result, node))
+//         result.WriteValue(7);
+// (end)
+class ReflectExport(reflect) CompiledPropertyPath
+{
+public:
+	CompiledPropertyPath();
+
+	// Function: Compile
+	// Parses *path* and resolves it for objects of class *root*.
+	//
+	// Returns:
+	//     false if the path does not parse, the compiled path is then empty.
+	bool Compile(string::Fragment path, const PersistentClass *root);
+
+	// Function: Resolve
+	// Evaluates the path on *object*, like <PersistentClass.ResolvePropertyPath>.
+	bool Resolve(PropertyPath &result, Persistent *object) const;
+
+	// Function: Resolve
+	// Evaluates the path on a const *object*, the result can only be read.
+	bool Resolve(PropertyPath &result, const Persistent *object) const;
+
+	// Function: Root
+	// The class the path was compiled for.
+	const PersistentClass *Root() const { return mRoot; }
+
+private:
+	enum StepType
+	{
+		PropertyStep,
+		DerefStep,
+		ArrayStep,
+		MapStep
+	};
+
+	struct Step
+	{
+		Step(StepType step_type)
+			: type(step_type)
+			, clazz(0)
+			, property(0)
+			, property_type(PropertyPath::Invalid)
+			, annotations(0)
+			, index(0)
+		{}
+
+		StepType type;
+
+		// PropertyStep: the property *name* as found in *clazz*.
+		string::SharedString name;
+		const PersistentClass *clazz;
+		const Property *property;
+		PropertyPath::NormalizedType property_type;
+		PersistentClass::Annotations *annotations;
+
+		// ArrayStep
+		unsigned index;
+
+		// MapStep: *key* is prebuilt when the key type was known.
+		Variant key;
+		string::String key_text;
+	};
+
+	bool Parse(string::Fragment path);
+	void Bind();
+	bool Resolve(PropertyPath &result, const Persistent *const_object, Persistent *object) const;
+
+	const PersistentClass *mRoot;
+	std::vector<Step> mSteps;
+};
+
+}
+
+#endif
@@ -43,6 +43,29 @@ public:
     // Refs this property into the <Variant> *value*.
     virtual bool RefData(const void *, void *, Variant &) const = 0;
 
+	// Struct: DirectAccess
+	// How to reach the data without a <Variant>, see <GetDirectAccess>.
+	//
+	//   get - returns the address of the data in an object.
+	//   set - assigns the data in an object from the address of a value.
+	struct DirectAccess
+	{
+		DirectAccess() : get(0), set(0) {}
+
+		const void *(*get)(const DataProperty *, const void *object);
+		void (*set)(const DataProperty *, void *object, const void *value);
+	};
+
+	// Function: GetDirectAccess
+	// Describes how to reach the data of type <DataType> directly.
+	//
+	// Returns:
+	//     false if the data can only be reached through <ReadData> and <WriteData>.
+	//
+	// See Also:
+	//     - <PropertyAccessor>
+	virtual bool GetDirectAccess(DirectAccess &access) const;
+
 	// Default implementation of Serialize
 	// This would be more efficient to override again in an implementation subclass.
 	void Serialize(const void *in, void *out, reflect::Reflector &reflector) const; // virtual
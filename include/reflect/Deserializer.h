@@ -10,6 +10,8 @@ class Dynamic;
 class Property;
 class Category;
 class EnumType;
+class Type;
+class ObjectArena;
 
 
 // Class: Deserializer
@@ -85,6 +87,17 @@ public:
 	// Once a text chunk read is started, clients must keep calling deserialize text chunk
 	// until complete is true.  
     virtual bool DeserializeTextChunk(char *text, unsigned &max_bytes, bool &complete) = 0;
+
+	// Function: DeserializeTextView
+	// Deserializes text without copying it, when the input is in memory
+	// (see <BufferedInputStream.Resident>) and the text is stored verbatim.
+	//
+	// The view refers into the deserializer's input, and is only valid as long as
+	// the input is.  When this returns false nothing has been consumed, and the text
+	// (if any) must be read with <DeserializeTextChunk>.
+	//
+	// The default implementation always returns false.
+	virtual bool DeserializeTextView(string::Fragment &text);
  
 	// Function: DeserializeData
 	// Deserializes a block of data.
@@ -100,9 +113,33 @@ public:
 	// Writes into the object using the <Properties'> method.
 	virtual bool DeserializeProperty(void *object, const Property *prop) = 0;
 
+	// Function: DeserializeArray
+	// Reads *count* contiguous items of the primitive *type*,
+	// which must have a <serialize::ArrayElement>.
+	//
+	// The default implementation reads each item as <Deserialize> would.
+	//
+	// See Also:
+	//    - <Serializer.SerializeArray>
+	virtual bool DeserializeArray(const Type *type, void *data, unsigned count);
+
+	// Function: SetArena
+	// Sets the <ObjectArena> objects are created in, or NULL
+	// (the default) to create them on the heap.
+	void SetArena(ObjectArena *arena) { mArena = arena; }
+
+	// Function: Arena
+	// The <ObjectArena> set with <SetArena>, or NULL.
+	ObjectArena *Arena() const { return mArena; }
+
 protected:
+	Deserializer() : mArena(0) {}
+
 	// Destructor: ~Deserializer
 	virtual ~Deserializer();
+
+private:
+	ObjectArena *mArena;
 };
 
 }
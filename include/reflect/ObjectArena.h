@@ -0,0 +1,64 @@
+#ifndef REFLECT_OBJECTARENA_H_
+#define REFLECT_OBJECTARENA_H_
+
+#include <reflect/config/config.h>
+#include <cstddef>
+#include <vector>
+
+namespace reflect {
+
+class Dynamic;
+
+// Class: ObjectArena
+//
+// Bump allocates objects into large slabs, and destroys them
+// all at once.
+//
+// Attach an arena to a <Deserializer> (see <Deserializer.SetArena>)
+// and <PersistentClass.DeserializePointer> creates every object of
+// the load in it, instead of making a heap allocation per object.
+// The graph is then released with the arena, by <Release> or its
+// destructor, and its objects must not be deleted individually
+// (not even by each other's destructors).
+class ReflectExport(reflect) ObjectArena
+{
+public:
+	// Constructor: ObjectArena
+	// Slabs are *slab_size* bytes, larger objects get a slab of their own.
+	ObjectArena(std::size_t slab_size = 1 << 20);
+
+	// Destructor: ~ObjectArena
+	// Calls <Release>.
+	~ObjectArena();
+
+	// Function: Allocate
+	// Returns *size* bytes aligned to *alignment* (a power of two).
+	void *Allocate(std::size_t size, std::size_t alignment);
+
+	// Function: Adopt
+	// Makes *object*, constructed in memory from <Allocate>,
+	// destroyed by <Release>.
+	void Adopt(Dynamic *object);
+
+	// Function: Release
+	// Destroys the adopted objects, newest first, and frees all slabs.
+	void Release();
+
+	// Function: Objects
+	// The number of adopted objects.
+	std::size_t Objects() const { return mObjects.size(); }
+
+private:
+	ObjectArena(const ObjectArena &);
+	void operator =(const ObjectArena &);
+
+	std::size_t mSlabSize;
+	std::vector<char *> mSlabs;
+	std::vector<Dynamic *> mObjects;
+	char *mCursor;
+	char *mEnd;
+};
+
+}
+
+#endif
@@ -40,6 +40,8 @@ public:
 
     ObjectType(void (*init_cb)() = 0);
 
+    ~ObjectType();
+
 	// Function: RegisterFunction
 	// Adds the function to the function map.
 	void RegisterFunction(const char *name, const function::Function *);
@@ -50,6 +52,8 @@ public:
     
 	// Function: Functions
 	// Accessor for the class <FunctionMap>.
+	// Functions added through the map are found once the type is
+	// loaded, use <RegisterFunction> for types which already are.
     FunctionMap &Functions();
 	
 	// Function: FindFunction
@@ -59,6 +63,8 @@ public:
 	// Function: FindFunction
 	// Finds a function in this class' <FunctionMap> or a parent class.
 	// The <SharedString> name should be in the global string stack.
+	// Looked up by the name's identity in a table of every inherited
+	// function, see <Type.CompileLookups>.
     const function::Function*FindFunction(string::SharedString name) const;
 
 	template<typename T>
@@ -82,11 +88,17 @@ protected:
     //virtual
     void Initialize();
 
+    //virtual
+    void BuildLookups();
+
 private:
+	class FunctionTable;
+
 	// Member: mFunctions
 	// The map of functions registered on this type.
 	FunctionMap *mFunctions;
     AnnotationMap *mAnnotationMap;
+	FunctionTable *mFunctionTable;
 };
 
 // Class: ObjectType::FunctionIterator
@@ -15,6 +15,7 @@ class PersistentCategory;
 class Serializer;
 class Deserializer;
 class PropertyPath;
+class ObjectArena;
 
 namespace string {
 class SharedString;
@@ -38,6 +39,8 @@ public:
 
     PersistentClass(void (*init_cb)() = 0);
 
+    ~PersistentClass();
+
     // Function: Construct
     //
     // Parameters:
@@ -58,6 +61,10 @@ public:
     //    A new instance of the class (if it's not Abstract)
     Persistent *Create() const;
 
+    // Function: Create(ObjectArena &)
+    // Creates the instance in *arena*, which owns it.
+    Persistent *Create(ObjectArena &arena) const;
+
 	// Function: AddProperty
 	// Adds the property to the property map.
 	// The property name should not be the same as any
@@ -72,6 +79,8 @@ public:
     
 	// Function: Properties
 	// Accessor for the class <PropertyMap>.
+	// Properties added through the map are found once the class is
+	// loaded, use <RegisterProperty> for classes which already are.
     PropertyMap &Properties();
 
 	// Function: FindProperty
@@ -81,6 +90,8 @@ public:
 	// Function: FindProperty
 	// Finds a property in this class' <PropertyMap> or a parent class.
 	// The <SharedString> name should be in the global string stack.
+	// Looked up by the name's identity in the flattened <SerializationPlan>,
+	// so the depth of the hierarchy doesn't matter, see <Type.CompileLookups>.
     const Property *FindProperty(string::SharedString name) const;
 
 	// Function: ResolvePropertyPath
@@ -133,9 +144,14 @@ public:
 	const Type *GetPropertyType(const Persistent *, string::Fragment path) const;
 
 	// Function: SerializeProperties
+	// Serializes every property of the object, this class' first,
+	// following the <SerializationPlan>.
     void SerializeProperties(const Persistent *, Reflector &) const;
 
 	// Function: DeserializeProperties
+	// Deserializes properties until the next tag isn't a property.
+	// Properties arriving in <SerializationPlan> order are matched
+	// without a lookup.
     void DeserializeProperties(Persistent *, Reflector &) const;
 
 	// Function: Serialize
@@ -143,17 +159,22 @@ public:
 
 	//virtual
 	void SerializePointer(const Dynamic *in, Reflector &reflector) const;
-	//virtual
-	void DeserializePointer(Dynamic *&out, Reflector &reflector) const;
+	// Function: DeserializePointer
+	// Creates and deserializes an object, in the deserializer's
+	// <Deserializer.Arena> when it has one.
+	void DeserializePointer(Dynamic *&out, Reflector &reflector) const; // virtual
 
 	template<typename Type>
 	class DescriptionHelper;
 
 	class PropertyIterator;
+	class SerializationPlan;
 private:
 	/*virtual*/ void Initialize();
+	/*virtual*/ void BuildLookups();
 
     PropertyMap *mProperties;
+	SerializationPlan *mPlan;
 };
 
 // Class: PersistentClass::PropertyIterator
@@ -10,6 +10,7 @@
 #include <reflect/property/DirectArrayProperty.hpp>
 #include <reflect/property/DirectVectorProperty.hpp>
 #include <reflect/property/DirectMapProperty.hpp>
+#include <reflect/property/DirectFragmentViewProperty.hpp>
 
 #include <reflect/property/AccessorProperty.hpp>
 #include <reflect/property/AccessorAccessProperty.hpp>
@@ -54,6 +55,7 @@ public:
 	struct ArrayAnnotation {} Array;
 	struct MapAnnotation {} Map;
 	struct VariantAnnotation {} Variant;
+	struct ViewAnnotation {} View;
 	
 	struct PropertyCollector
 	{
@@ -109,6 +111,13 @@ public:
 					static_cast<MemberType Persistent::*>(pmember)));
 		}
 		
+		PropertyAnnotator operator ()(const char *name, string::Fragment T::*pmember, const ViewAnnotation &) const
+		{
+			return PropertyAnnotator(name,
+				new property::DirectFragmentViewProperty<Persistent>(
+					static_cast<string::Fragment Persistent::*>(pmember)));
+		}
+		
 		template<typename MemberType>
 		PropertyAnnotator operator ()(const char *name, MemberType (T::*getter)() const, void (T::*setter)(MemberType)) const
 		{
@@ -214,6 +223,7 @@ public:
 	//   ("name", &MyClass::mArrayVar, Array) - <DirectArrayProperty> 
 	//   ("name", &MyClass::mVectorVar, Array) - <DirectVectorProperty>
 	//   ("name", &MyClass::mVar, Map) - <DirectMapProperty>
+	//   ("name", &MyClass::mFragment, View) - <DirectFragmentViewProperty>
 	//   ("name", &MyClass::ser_fun, &MyClass::deser_fun, Variant) - <VariantProperty>
 	PropertyCollector Properties;
 };
@@ -80,6 +80,30 @@ public:
 
 		TypeOf<T>()->SetSerializer(&Helper::SerializeType);
 	}
+
+	// Function: TextConversions
+	// Sets the type's <Type::SetTextConversions> with functions
+	// typed for *As* (T or a base of it).
+	template<typename As,
+		bool (*Parser)(const string::Fragment &text, As &value),
+		bool (*Formatter)(const As &value, string::String &text)>
+	void TextConversions() const
+	{
+		struct Helper
+		{
+			static bool Parse(void *out, const string::Fragment &text)
+			{
+				return Parser(text, *static_cast<As *>(translucent_cast<T *>(out)));
+			}
+
+			static bool Format(const void *in, string::String &text)
+			{
+				return Formatter(*static_cast<const As *>(translucent_cast<const T *>(in)), text);
+			}
+		};
+
+		TypeOf<T>()->SetTextConversions(&Helper::Parse, &Helper::Format);
+	}
 	
 	struct
 	{
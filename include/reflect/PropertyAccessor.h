@@ -0,0 +1,122 @@
+#ifndef REFLECT_PROPERTYACCESSOR_H_
+#define REFLECT_PROPERTYACCESSOR_H_
+
+#include <reflect/DataProperty.h>
+#include <reflect/Variant.h>
+#include <reflect/autocast.h>
+
+namespace reflect {
+
+// Class: PropertyAccessor
+//
+// Reads and writes a <DataProperty> of type T with no <Variant>.
+//
+// When the property's <DataProperty.DataType> is T and it provides
+// <DataProperty.GetDirectAccess> (as <DirectDataProperty> and
+// <AccessorDirectProperty> do) values are copied straight to and from
+// the object through the property's functions.
+// Other data properties, or a T other than the data type, go through
+// <DataProperty.ReadData> and <DataProperty.WriteData> with a variant
+// referencing the value.
+//
+// Objects are passed as for <DataProperty.ReadData>, for example:
+// (code)
+// PropertyAccessor<float> x(TypeOf<Point>()->FindProperty("x"));
+// for(each point)
+//     x.Write(point, x.Get(point) * 2);
+// (end)
+template<typename T>
+class PropertyAccessor
+{
+public:
+	PropertyAccessor()
+		: mProperty(0)
+	{
+	}
+
+	explicit PropertyAccessor(const Property *property)
+		: mProperty(0)
+	{
+		Bind(property);
+	}
+
+	// Function: Bind
+	// Accesses *property* from now on.
+	//
+	// Returns:
+	//     false if *property* is not a <DataProperty>.
+	bool Bind(const Property *property)
+	{
+		mProperty = property % autocast;
+		mAccess = DataProperty::DirectAccess();
+
+		if(mProperty && !(mProperty->DataType() == TypeOf<T>() && mProperty->GetDirectAccess(mAccess)))
+			mAccess = DataProperty::DirectAccess();
+
+		return mProperty != 0;
+	}
+
+	// Function: Valid
+	// True when bound to a <DataProperty>.
+	bool Valid() const { return mProperty != 0; }
+
+	// Function: Direct
+	// True when values are accessed without a <Variant>.
+	bool Direct() const { return mAccess.get != 0; }
+
+	// Function: Property
+	// The bound property.
+	const DataProperty *Property() const { return mProperty; }
+
+	// Function: Read
+	// Copies the data of *object* to *value*.
+	bool Read(const void *object, T &value) const
+	{
+		if(mAccess.get)
+		{
+			value = *static_cast<const T *>(mAccess.get(mProperty, object));
+			return true;
+		}
+		else if(mProperty)
+		{
+			Variant ref = Variant::FromRef(value);
+			return mProperty->ReadData(object, ref);
+		}
+
+		return false;
+	}
+
+	// Function: Get
+	// The data of *object*, or a default T if it could not be read.
+	T Get(const void *object) const
+	{
+		T value = T();
+		Read(object, value);
+		return value;
+	}
+
+	// Function: Write
+	// Assigns *value* to the data of *object*.
+	bool Write(void *object, const T &value) const
+	{
+		if(mAccess.set)
+		{
+			mAccess.set(mProperty, object, &value);
+			return true;
+		}
+		else if(mProperty)
+		{
+			return mProperty->WriteData(object, Variant::FromConstRef(value));
+		}
+
+		return false;
+	}
+
+private:
+	const DataProperty *mProperty;
+	DataProperty::DirectAccess mAccess;
+};
+
+}
+
+#endif
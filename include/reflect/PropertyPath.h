@@ -157,6 +157,11 @@ public:
 	// requires <IsMap()> to be true.
 	PropertyPath MapItem(string::Fragment key) const;
 
+	// Function: MapItem(const Variant &) const
+	// gets a map item by a key already of the map's key type,
+	// requires <IsMap()> to be true.
+	PropertyPath MapItem(const Variant &key) const;
+
 	// Function: GetType
 	// retrieves the type of this path as an enum.
 	NormalizedType GetType() const;
@@ -251,8 +256,14 @@ public:
 	bool WriteData(const Variant &value) const;
 	
 private:
+	friend class CompiledPropertyPath;
+
 	InternalType GetInternalType() const;
 	bool AdvanceInternal(string::Fragment path);
+	void SetProperty(const reflect::Property *prop, NormalizedType type);
+
+	static NormalizedType PropertyType(const reflect::Property *prop);
+	static bool ParseIndex(string::Fragment text, unsigned &index);
 
 	NormalizedType mType;
 	InternalType mInternalType;
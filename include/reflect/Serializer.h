@@ -10,6 +10,7 @@ class Dynamic;
 class Property;
 class Category;
 class EnumType;
+class Type;
 
 // Class: Serializer
 //
@@ -68,6 +69,13 @@ public:
     //    - <Deserializer.Reference>
     virtual bool Reference(const Dynamic *object) = 0;
 
+	// Function: Reserve
+	// A hint that about *objects* objects will be <Reference>d,
+	// so reference tracking can be sized up front.
+	//
+	// The default implementation does nothing.
+	virtual void Reserve(unsigned objects);
+
 	// Function: SerializeText
 	// Emits a string.
     virtual bool SerializeText(const char *text, unsigned nbytes) = 0;
@@ -82,6 +90,18 @@ public:
 
 	// Function: SerializeProperty
 	virtual bool SerializeProperty(const void *object, const Property *prop) = 0;
+
+	// Function: SerializeArray
+	// Emits *count* contiguous items of the primitive *type*,
+	// which must have a <serialize::ArrayElement>.
+	//
+	// Used by <ArrayProperty.Serialize> for arrays with <ArrayProperty.ItemData>.
+	// The default implementation emits each item as <Serialize> would,
+	// serializers may store the items as a block.
+	//
+	// See Also:
+	//    - <Deserializer.DeserializeArray>
+	virtual bool SerializeArray(const Type *type, const void *data, unsigned count);
 	
 protected:
     // Destructor: ~Serializer
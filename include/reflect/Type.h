@@ -10,7 +10,7 @@ namespace reflect {
 
 class Reflector;
 
-namespace string { class SharedString; class FoundSharedString; }
+namespace string { class SharedString; class FoundSharedString; class Fragment; class String; }
 
 // Class: Type
 class ReflectExport(reflect) Type : public Dynamic
@@ -23,6 +23,8 @@ public:
 	typedef std::map<string::SharedString, Type *> TypeMapType;
 	typedef void (*Conversion)(void *, const void *);
 	typedef std::map<const Type *, Conversion> ConversionMap;
+	typedef bool (*TextParser)(void *, const string::Fragment &);
+	typedef bool (*TextFormatter)(const void *, string::String &);
 
 	// Constructor: Type
 	// Constructs a class.
@@ -104,6 +106,26 @@ public:
     // - Remove conversions from all classes to unloaded types.
     static void UnloadTypes(Type *);
 
+	// Function: LookupGeneration
+	// Changes whenever types are loaded or unloaded or members are registered,
+	// lookups cached across a class hierarchy are stale once it does.
+	static unsigned LookupGeneration();
+
+	// Function: InvalidateLookups
+	// Advances the <LookupGeneration>.
+	static void InvalidateLookups();
+
+	// Function: CompileLookups
+	// Rebuilds the member tables of this type and its subclasses
+	// (see <ObjectType::FindFunction> and <PersistentClass::FindProperty>),
+	// and advances the <LookupGeneration>.
+	//
+	// <LoadTypes> and <UnloadTypes> build the tables of the types they
+	// change and members registered on loaded types rebuild them, so
+	// finding a member only reads them.  Types must not be loaded,
+	// unloaded or have members registered while other threads use them.
+	void CompileLookups();
+
 	// Function: AnyRootType
 	// Retrieves a root (any root) of the type hierarchy.
 	// roots are connected by <NextSibling>
@@ -129,6 +151,21 @@ public:
 	//    The type or NULL if no type is registered with that name.
 	static Type *FindType(const char *);
 
+	// Function: FindType(Fragment, unsigned)
+	// Retrieves a type by name and the name's <HashName>,
+	// from a hash index of the registered types.
+	//
+	// This doesn't search the string pool, so it is the fast
+	// way to resolve names read from a stream.
+	//
+	// Result:
+	//    The type or NULL if no type is registered with that name.
+	static Type *FindType(const string::Fragment &name, unsigned hash);
+
+	// Function: HashName
+	// The hash of a type name used by <FindType(Fragment, unsigned)>.
+	static unsigned HashName(const string::Fragment &name);
+
 	// Function: SetName
 	// Sets the name of the type and calls RegisterName to it in a global map.
     void SetName(const char *name);
@@ -137,6 +174,10 @@ public:
 	// The registered name of this type.
     const char *Name() const;
 
+	// Function: NameHash
+	// <HashName> of <Name>, computed once by <SetName>.
+	unsigned NameHash() const { return mNameHash; }
+
 	// Function: NextTypeToLoad
 	// The next type in a NULL terminated chain of
 	// types to load in <Type::LoadTypes>.
@@ -266,11 +307,45 @@ public:
 	// - <Type::DescriptionHelper> converson features.
 	virtual bool ConvertValue(void *opaque, const void *source, const Type *from) const;
 
+	// Function: SetTextConversions
+	// Registers functions which read and write values of this type
+	// as the <StandardSerializer> text for them, without a serializer.
+	//
+	// Either function may decline (return false) for text it doesn't
+	// handle, and the caller uses a serializer instead.
+	//
+	// See Also:
+	// - <Variant::ToString>
+	// - <Variant::FromString>
+	void SetTextConversions(TextParser, TextFormatter);
+
+	// Function: ParseText
+	// Reads *text* into the value at *opaque*, with the <TextParser>.
+	//
+	// Returns:
+	//   false - if there is no parser, or it declined (*opaque* is unchanged).
+	bool ParseText(void *opaque, const string::Fragment &text) const;
+
+	// Function: HasTextParser
+	// Whether <ParseText> may succeed.
+	bool HasTextParser() const { return 0 != mTextParser; }
+
+	// Function: FormatText
+	// Writes the value at *opaque* to *text*, with the <TextFormatter>.
+	//
+	// Returns:
+	//   false - if there is no formatter, or it declined.
+	bool FormatText(const void *opaque, string::String &text) const;
+
 	static const TypeMapType &GlobalTypeMap();
 
 protected:
     virtual void Initialize();
 
+	// Function: BuildLookups
+	// Builds this type's member tables, see <CompileLookups>.
+	virtual void BuildLookups();
+
 private:
     void CompileHierarchy();
 	void ReleaseCompiledHierarchy(Type **hierarchy);
@@ -288,6 +363,7 @@ private:
 
     void (*mTypeInitializerCB)();
     const char *mName;
+    unsigned mNameHash;
 
     int mDepth;
     Type **mHierarchy;
@@ -300,6 +376,8 @@ private:
     void *(*mDestructor)(void *);
  
     ConversionMap mConversions;
+	TextParser mTextParser;
+	TextFormatter mTextFormatter;
 };
 
 }
@@ -26,17 +26,25 @@ namespace reflect {
 // any time an interface with specific typeinfo needs to be
 // exposed with a generic interface.
 //
-// Variants share data.  A copy of a reference variant
-// (created with <Variant::Ref> or <Variant::ConstRef>)
-// will refer to the same data.
+// A copy of a reference variant (created with <Variant::Ref> or
+// <Variant::ConstRef>) will refer to the same data.
 // A copy of a constructed variant (created with <Variant::Copy> or
-// a blank one after <SetValue> or <Construct>) will share
-// the object, the last one to destruct will deallocate it.
-// This pattern makes it possible to return
-// variants from functions.
-// Operations like <operator=> or <Construct> unshares the variant.
+// a blank one after <SetValue> or <Construct>) depends on the value's type:
+// small primitive values (ints, doubles, string fragments, ...) are held
+// inside the variant and copied, so writing to one copy does not change the
+// others, while other values are allocated and shared, the last variant to
+// destruct deallocating them.  Either way variants can be returned from
+// functions.  Operations like <operator=> or <Construct> unshare the variant.
 //
-// Reference counting is achieved using a circular singly-linked list.
+// Allocated values are reference counted by a control block placed
+// before the value, so copying and releasing a variant take constant
+// time.  Define REFLECT_ATOMIC_VARIANT when building the library to
+// make the counts atomic, so copies of a variant can be handed to other
+// threads (the value itself is not synchronized).  Aliases (see <Alias>)
+// are kept in a circular doubly-linked list, for <UpdateAliases>.
+//
+// Inline values cost no heap allocation, they are moved to the heap
+// if another variant references them (see <Ref>, <ConstRef> and <Alias>).
 class ReflectExport(reflect) Variant
 {
 public:
@@ -54,6 +62,11 @@ public:
 	// copies another variant
 	const Variant &operator=(const Variant &other);
 
+	// Function: Swap
+	// Exchanges values with *other*, without copying allocated values.
+	// Use it to move a variant, e.g., out of a function's result.
+	void Swap(Variant &other);
+
 	// Function: FromRef
 	// Builds a Variant which can references a value.
 	// The value must persist as long as this Variant
@@ -73,12 +86,12 @@ public:
 	// This is function is primarily intended to be used with string literals,
 	// which (without casting) are statically typed as const arrays.
 	//
-	// NOTE: This allocates a pointer to point to the array.
+	// NOTE: The variant holds a pointer to point to the array.
 	template<typename T, unsigned size>
 	static Variant FromConstRef(const T (&value)[size])
 	{
 		Variant array_variant;
-		const T *&pointer = *reinterpret_cast<const T **>(array_variant.mAllocation = new char[sizeof(const T *)]);
+		const T *&pointer = *reinterpret_cast<const T **>(array_variant.mAllocation = array_variant.mInline.bytes);
 		pointer = value;
 		array_variant.mConstData = opaque_cast(&pointer);
 		array_variant.mType = TypeOf<T *>();
@@ -111,7 +124,7 @@ public:
 	static Variant FromStaticValue(const T (&value)[size])
 	{
 		Variant array_variant;
-		const T *&pointer = *reinterpret_cast<const T **>(array_variant.mAllocation = new char[sizeof(const T *)]);
+		const T *&pointer = *reinterpret_cast<const T **>(array_variant.mAllocation = array_variant.mInline.bytes);
 		pointer = value;
 		array_variant.mConstData = opaque_cast(&pointer);
 		array_variant.mType = TypeOf<T *>();
@@ -216,11 +229,13 @@ public:
 	void Serialize(Reflector &reflector) const;
 
 	// Function: ToString
-	// Serializes with the <StandardSerializer>.
+	// Serializes with the <StandardSerializer>, or directly
+	// with the type's <Type::FormatText>.
 	string::String ToString() const;
 
 	// Function: FromString
-	// Deserializes with the <StandardSerializer>,
+	// Deserializes with the <StandardSerializer>, or directly
+	// with the type's <Type::ParseText>,
 	// at least a <Type> must be bound.
 	//
 	// Returns:
@@ -332,12 +347,28 @@ private:
 	void Share(const Variant &other);
 	void Release();
 	void ClearAllocation();
-	
+	void LinkAlias(Variant &other);
+
+	bool OwnsInline() const { return mAllocation == mInline.bytes; }
+	bool ConstructValue(const Type *type);
+	void Promote();
+
+	// storage for small values, see <ConstructValue>.
+	union InlineStorage
+	{
+		char bytes[16];
+		double align_double;
+		void *align_pointer;
+		long align_long;
+	};
+
+	InlineStorage mInline;
 	char *mAllocation;
 	const Type *mType;
 	const void *mConstData;
 	void *mData;
 	mutable Variant *mLink;
+	mutable Variant *mPrevLink;
 };
 
 template<>
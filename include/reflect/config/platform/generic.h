@@ -9,4 +9,9 @@
 # define REFLECT_IMPORT_ANNOTATION
 #endif
 
+// without thread local storage, contexts are shared by every thread.
+#ifndef REFLECT_THREAD_LOCAL
+# define REFLECT_THREAD_LOCAL
+#endif
+
 #endif
@@ -24,4 +24,9 @@
 
 #endif
 
+// thread local storage for <utility::Context>.
+#if defined(__GNUC__) && !defined(REFLECT_THREAD_LOCAL)
+# define REFLECT_THREAD_LOCAL __thread
+#endif
+
 #endif
@@ -20,6 +20,11 @@
 // disable warnings about unsafe functions
 # pragma warning (disable : 4996)
 
+// thread local storage for <utility::Context>.
+# ifndef REFLECT_THREAD_LOCAL
+#  define REFLECT_THREAD_LOCAL __declspec(thread)
+# endif
+
 #endif
 
 #endif
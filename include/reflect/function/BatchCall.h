@@ -0,0 +1,127 @@
+#ifndef REFLECT_FUNCTION_BATCHCALL_H_
+#define REFLECT_FUNCTION_BATCHCALL_H_
+
+#include <reflect/function/Function.h>
+#include <reflect/config/config.h>
+#include <cstddef>
+
+namespace reflect {
+class ArrayProperty;
+}
+
+namespace reflect { namespace function {
+
+// Class: BatchCall
+//
+// Calls one <Function> many times, for an array of objects or the
+// items of an <ArrayProperty>, taking each call's arguments from columns.
+//
+// A column is an array of values, one per call, *stride* bytes apart
+// (0 passes the same value to every call).  Columns are checked against
+// the parameters once, when they are given: columns of the parameter's
+// type are passed by address, others are converted for each call with
+// <Type.ConvertValue>, and pointers to related classes are checked item by
+// item.  Mutable parameters need columns of their exact type.  A call whose
+// arguments can't be converted is skipped, and its result left untouched.
+// The calls go through the function's typed entry point, with no
+// <Parameters> or <Variant>s built per call, and can be split across threads.
+//
+// Example:
+// (code)
+// BatchCall bounds(clazz->FindFunction("Recompute"));
+// bounds.Constant(0, padding);
+// bounds.CallItems(items_property, opaque_cast(scene), 4);
+// (end)
+class ReflectExport(reflect) BatchCall
+{
+public:
+	BatchCall(const Function *function);
+
+	// Function: Valid
+	// True if the function can be called in batches.
+	bool Valid() const { return 0 != mInvoke; }
+
+	// Function: Argument
+	// Passes the *type* values at *items*, *stride* bytes apart,
+	// as the parameter *index*.  The items are read by each <Call>.
+	//
+	// Returns:
+	//     false if the values can't be passed as the parameter.
+	bool Argument(int index, const Type *type, const void *items, std::ptrdiff_t stride);
+
+	// Function: MutableArgument
+	// As <Argument>, for values the function may modify.
+	bool MutableArgument(int index, const Type *type, void *items, std::ptrdiff_t stride);
+
+	// Function: Results
+	// Stores the result of each call as a *type* value at *items*,
+	// *stride* bytes apart.  Results are discarded if this isn't called.
+	bool Results(const Type *type, void *items, std::ptrdiff_t stride);
+
+	template<typename T>
+	bool Argument(int index, const T *items) { return Argument(index, TypeOf<T>(), items, sizeof(T)); }
+
+	template<typename T>
+	bool MutableArgument(int index, T *items) { return MutableArgument(index, TypeOf<T>(), items, sizeof(T)); }
+
+	// Function: Constant
+	// Passes a copy of *value* to every call as the parameter *index*.
+	bool Constant(int index, const Variant &value);
+
+	template<typename T>
+	bool Constant(int index, const T &value) { return Constant(index, Variant::FromConstRef(value)); }
+
+	template<typename T>
+	bool Results(T *items) { return Results(TypeOf<T>(), items, sizeof(T)); }
+
+	// Function: Call (function)
+	// Calls a function which is not a method *count* times,
+	// on up to *threads* threads.
+	//
+	// Returns:
+	//     false if an argument is missing, or some call's
+	// arguments or result could not be converted.
+	bool Call(unsigned count, unsigned threads = 1) const;
+
+	// Function: Call (method)
+	// Calls a method for each of the *count* opaque *objects*,
+	// which are all of (or derive from) *object_type*.
+	bool Call(const Type *object_type, void *const *objects, unsigned count, unsigned threads = 1) const;
+
+	// Function: CallItems
+	// Calls a method for each item of the *array* of *object*.
+	// Items may be objects or pointers to <Dynamic> objects,
+	// the items are all resolved before the first call.
+	bool CallItems(const ArrayProperty *array, void *object, unsigned threads = 1) const;
+
+private:
+	BatchCall(const BatchCall &);
+	void operator =(const BatchCall &);
+
+	struct Column
+	{
+		Column() : type(0), data(0), stride(0), convert(false) {}
+
+		const Type *type;
+		char *data;
+		std::ptrdiff_t stride;
+		bool convert;
+	};
+
+	struct Range;
+	static void RunRange(void *range);
+
+	bool Ready() const;
+	bool Dispatch(void *const *objects, unsigned count, unsigned threads) const;
+	bool Run(void *const *objects, unsigned begin, unsigned end) const;
+
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+	Column mColumns[Function::MaxParameters];
+	Variant mConstants[Function::MaxParameters];
+	Column mResults;
+};
+
+} }
+
+#endif
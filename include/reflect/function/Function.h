@@ -8,6 +8,7 @@
 namespace reflect { namespace function {
 
 class Parameters;
+template<typename FunctionType> class Invoker;
 
 // Class: Function
 //
@@ -80,6 +81,11 @@ public:
 	// The number of parameters passed to this function.
 	int NumParameters() const { return mParameterCount; }
 
+	// Constant: MaxParameters
+	// The most parameters a function can have, as generated
+	// in FunctionSignature.hpp.
+	enum { MaxParameters = 15 };
+
 	// Function: ClassifyParameter
 	// Returns the type of parameter at *index*, and changes *is_mutable* to true
 	// if the parameter is passed as a non-const reference.
@@ -107,29 +113,72 @@ public:
 	// Function: CallObjectType
 	// Returns the type of "this" pointer needed.
 	const Type *CallObjectType() const { return mObjectType; }
+
+	// Function: Invoke
+	// Returns an <Invoker> calling this function as FunctionType,
+	// for example:
+	// > double result = function->Invoke<double (int, float)>()(object, 1, 2.f);
+	//
+	// Keep the invoker to check the signature only once.
+	// Defined in reflect/function/Invoker.hpp.
+	template<typename FunctionType>
+	Invoker<FunctionType> Invoke() const;
+
+	// Typedef: InvokeFunction
+	// A typed entry point of a function, see <FindInvoke>.
+	//
+	// *object* is the opaque "this" pointer, *args* point to values of
+	// each parameter's type, and *result*, unless null, to a value of the
+	// result type which is assigned the result.
+	typedef void (*InvokeFunction)(const Function *function, void *object, void *const *args, void *result);
+
+	// Function: FindInvoke
+	// Returns the typed entry point of this function if its parameters are
+	// *parameter_types* and its result is *result_type* (null for any result),
+	// and the mutable parameters are among the *mutable_parameters* bits.
+	// Used by <Invoker>.
+	InvokeFunction FindInvoke(const Type *result_type, const Type *const *parameter_types, int count, unsigned mutable_parameters) const;
 	
 protected:
 	typedef const Type *(*ParameterTypeFun)(int index, bool *is_mutable);
 
 	// Constructor: Function (protected)
-	Function(const char *name, const Type *object_type, ParameterTypeFun arg_type_fun, const Type *result_type);
+	Function(const char *name, const Type *object_type, ParameterTypeFun arg_type_fun, const Type *result_type, InvokeFunction invoke = 0);
 
 	// Function: CallInternal (protected)
 	virtual bool CallInternal(const Variant &self, Variant *args, Variant &result) const = 0;
 
 private:
+	friend class Parameters;
+
 	const char *mName;
 	const Type *const mObjectType;
 	ParameterTypeFun mParameterTypeFun;
 	const Type *const mResultType;
 	int mParameterCount;
+	InvokeFunction mInvoke;
+
+	// the parameter types, and a bit per mutable parameter,
+	// so calls don't go through mParameterTypeFun.
+	const Type *mParameterTypes[MaxParameters];
+	unsigned mMutableParameters;
 };
 
 // Class: Parameters
 // Represents a parameter list passed to a <Function>.
+//
+// Parameter lists are meant to live on the stack: the variants for up
+// to <InlineParameters> parameters are stored in the list itself, and
+// small values are stored in the variants, so building a list and
+// calling a function does not allocate.  A list can be reused for any
+// number of calls, assigning new values to its parameters in between.
 class ReflectExport(reflect) Parameters
 {
 public:
+	// Constant: InlineParameters
+	// Lists with more parameters keep their variants on the heap.
+	enum { InlineParameters = 6 };
+
 	// Constructor: Parameters
 	// Builds a parameter list for a function.
 	Parameters(const Function *fun);
@@ -146,6 +195,9 @@ public:
 	// Checks if this parameter list is valid to call a particular
 	// function.  The types must match exactly and the mutable parameters
 	// must cover the mutable parameters needed by the function call.
+	//
+	// Parameters still of the types they were bound to when the list
+	// was built for *function* are checked without walking the hierarchy.
 	bool ValidForFunction(const Function *function) const;
 
 	class ReflectExport(reflect) FunctionParameter;
@@ -181,8 +233,18 @@ private:
 	const Parameters &operator =(const Parameters &);
 	Parameters(const Parameters &);
 	
+	// storage for the first <InlineParameters> variants.
+	union InlineStorage
+	{
+		char bytes[InlineParameters * sizeof(Variant)];
+		double align_double;
+		void *align_pointer;
+		long align_long;
+	};
+
 	int mCount;
 	Variant *mParams;
+	InlineStorage mInline;
 };
 
 class Parameters::FunctionParameter
@@ -3,6 +3,7 @@
 
 #include <reflect/function/Function.h>
 #include <reflect/function/FunctionSignature.hpp>
+#include <reflect/function/Invoker.hpp>
 
 namespace reflect { namespace function {
 
@@ -19,7 +20,8 @@ struct FunctionImpl
 			name,
             FunctionSignature<FunctionType>::GetClassType(),
             FunctionSignature<FunctionType>::GetParameterType,
-            FunctionSignature<FunctionType>::GetResultType())
+            FunctionSignature<FunctionType>::GetResultType(),
+            &FunctionImpl::Invoke)
 		, mFunction(function)
     {}
 	
@@ -60,6 +62,19 @@ struct FunctionImpl
 		}
     }
 
+	// the <Function::InvokeFunction>, the types were checked by <Function::FindInvoke>.
+	static void Invoke(const Function *function, void *object, void *const *args, void *result)
+	{
+		// (ResultType would name Function::ResultType here.)
+		typedef typename ParameterHelper<typename FunctionSignature<FunctionType>::TheResultType>::Type Value;
+		const FunctionType &target = static_cast<const FunctionImpl *>(function)->mFunction;
+
+		if(result)
+			*static_cast<Value *>(result) = FunctionSignature<FunctionType>::Invoke(target, object, args);
+		else
+			FunctionSignature<FunctionType>::Invoke(target, object, args);
+	}
+
 private:
     FunctionType mFunction;
 };
@@ -74,7 +89,8 @@ struct FunctionImpl<FunctionType, void>
         : Function(name,
              FunctionSignature<FunctionType>::GetClassType(),
              FunctionSignature<FunctionType>::GetParameterType,
-             FunctionSignature<FunctionType>::GetResultType()
+             FunctionSignature<FunctionType>::GetResultType(),
+             &FunctionImpl::Invoke
             )
 		, mFunction(function)
     {}
@@ -118,6 +134,13 @@ struct FunctionImpl<FunctionType, void>
 		result.BindType<void>();
 		return true;
     }
+
+	// the <Function::InvokeFunction>, the types were checked by <Function::FindInvoke>.
+	static void Invoke(const Function *function, void *object, void *const *args, void *)
+	{
+		FunctionSignature<FunctionType>::Invoke(
+			static_cast<const FunctionImpl *>(function)->mFunction, object, args);
+	}
     
 private:
     FunctionType mFunction;
@@ -126,6 +126,11 @@ public:
 	{		
 		return (*function)();
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *)
+	{
+		return (*function)();
+	}
 };
 
 template<typename ResultType, typename A0>
@@ -161,6 +166,12 @@ public:
 		typename P0::ArgType arg0 = P0::Arg(args[0]);		
 		return (*function)(arg0);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1>
@@ -198,6 +209,13 @@ public:
 		typename P1::ArgType arg1 = P1::Arg(args[1]);		
 		return (*function)(arg0, arg1);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2>
@@ -237,6 +255,14 @@ public:
 		typename P2::ArgType arg2 = P2::Arg(args[2]);		
 		return (*function)(arg0, arg1, arg2);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3>
@@ -278,6 +304,15 @@ public:
 		typename P3::ArgType arg3 = P3::Arg(args[3]);		
 		return (*function)(arg0, arg1, arg2, arg3);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4>
@@ -321,6 +356,16 @@ public:
 		typename P4::ArgType arg4 = P4::Arg(args[4]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5>
@@ -366,6 +411,17 @@ public:
 		typename P5::ArgType arg5 = P5::Arg(args[5]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6>
@@ -413,6 +469,18 @@ public:
 		typename P6::ArgType arg6 = P6::Arg(args[6]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7>
@@ -462,6 +530,19 @@ public:
 		typename P7::ArgType arg7 = P7::Arg(args[7]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8>
@@ -513,6 +594,20 @@ public:
 		typename P8::ArgType arg8 = P8::Arg(args[8]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9>
@@ -566,6 +661,21 @@ public:
 		typename P9::ArgType arg9 = P9::Arg(args[9]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10>
@@ -621,6 +731,22 @@ public:
 		typename P10::ArgType arg10 = P10::Arg(args[10]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11>
@@ -678,6 +804,23 @@ public:
 		typename P11::ArgType arg11 = P11::Arg(args[11]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12>
@@ -737,6 +880,24 @@ public:
 		typename P12::ArgType arg12 = P12::Arg(args[12]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13>
@@ -798,6 +959,25 @@ public:
 		typename P13::ArgType arg13 = P13::Arg(args[13]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]),
+			*static_cast<typename P13::Type *>(args[13]));
+	}
 };
 
 template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13, typename A14>
@@ -861,6 +1041,26 @@ public:
 		typename P14::ArgType arg14 = P14::Arg(args[14]);		
 		return (*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *, void *const *args)
+	{
+		return (*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]),
+			*static_cast<typename P13::Type *>(args[13]),
+			*static_cast<typename P14::Type *>(args[14]));
+	}
 };
 
 template<typename ResultType, typename ClassType>
@@ -890,6 +1090,12 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)();
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)();
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0>
@@ -926,6 +1132,13 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1>
@@ -964,6 +1177,14 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2>
@@ -1004,6 +1225,15 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3>
@@ -1046,6 +1276,16 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4>
@@ -1090,6 +1330,17 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5>
@@ -1136,6 +1387,18 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6>
@@ -1184,6 +1447,19 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7>
@@ -1234,6 +1510,20 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8>
@@ -1286,6 +1576,21 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9>
@@ -1340,6 +1645,22 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10>
@@ -1396,6 +1717,23 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11>
@@ -1454,6 +1792,24 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12>
@@ -1514,6 +1870,25 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13>
@@ -1576,6 +1951,26 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]),
+			*static_cast<typename P13::Type *>(args[13]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13, typename A14>
@@ -1640,6 +2035,27 @@ public:
 		ClassType &self = object.AsRef<ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		ClassType &self = *translucent_cast<ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]),
+			*static_cast<typename P13::Type *>(args[13]),
+			*static_cast<typename P14::Type *>(args[14]));
+	}
 };
 
 template<typename ResultType, typename ClassType>
@@ -1669,6 +2085,12 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)();
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)();
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0>
@@ -1705,6 +2127,13 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1>
@@ -1743,6 +2172,14 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2>
@@ -1783,6 +2220,15 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3>
@@ -1825,6 +2271,16 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4>
@@ -1869,6 +2325,17 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5>
@@ -1915,6 +2382,18 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6>
@@ -1963,6 +2442,19 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7>
@@ -2013,6 +2505,20 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8>
@@ -2065,6 +2571,21 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9>
@@ -2119,6 +2640,22 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10>
@@ -2175,6 +2712,23 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11>
@@ -2233,6 +2787,24 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12>
@@ -2293,6 +2865,25 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13>
@@ -2355,6 +2946,26 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]),
+			*static_cast<typename P13::Type *>(args[13]));
+	}
 };
 
 template<typename ResultType, typename ClassType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13, typename A14>
@@ -2419,6 +3030,27 @@ public:
 		const ClassType &self = object.AsConstRef<const ClassType>();
 		return (self.*function)(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14);
 	}
+
+	static ResultType Invoke(const FunctionType &function, void *object, void *const *args)
+	{
+		const ClassType &self = *translucent_cast<const ClassType *>(object);
+		return (self.*function)(
+			*static_cast<typename P0::Type *>(args[0]),
+			*static_cast<typename P1::Type *>(args[1]),
+			*static_cast<typename P2::Type *>(args[2]),
+			*static_cast<typename P3::Type *>(args[3]),
+			*static_cast<typename P4::Type *>(args[4]),
+			*static_cast<typename P5::Type *>(args[5]),
+			*static_cast<typename P6::Type *>(args[6]),
+			*static_cast<typename P7::Type *>(args[7]),
+			*static_cast<typename P8::Type *>(args[8]),
+			*static_cast<typename P9::Type *>(args[9]),
+			*static_cast<typename P10::Type *>(args[10]),
+			*static_cast<typename P11::Type *>(args[11]),
+			*static_cast<typename P12::Type *>(args[12]),
+			*static_cast<typename P13::Type *>(args[13]),
+			*static_cast<typename P14::Type *>(args[14]));
+	}
 };
 
 } }
@@ -5,16 +5,17 @@ static function template binding generator for reflect.
 """
 
 sigfile = file('FunctionSignature.hpp', 'w')
+invokerfile = file('Invoker.hpp', 'w')
 
-def Guard(text):
-    sigfile.write('#ifndef %s\n' % text)
-    sigfile.write('#define %s\n\n' % text)
-    def end(): sigfile.write('#endif // %s\n' % text)
+def Guard(out, text):
+    out.write('#ifndef %s\n' % text)
+    out.write('#define %s\n\n' % text)
+    def end(): out.write('#endif // %s\n' % text)
     return end
 
-def Namespaces(*namespaces):
-    sigfile.write(' '.join(['namespace %s {' % ns for ns in namespaces]) + '\n\n')
-    def end(): sigfile.write(' '.join(['}' for ns in namespaces]) + '\n\n')
+def Namespaces(out, *namespaces):
+    out.write(' '.join(['namespace %s {' % ns for ns in namespaces]) + '\n\n')
+    def end(): out.write(' '.join(['}' for ns in namespaces]) + '\n\n')
     return end
 
 def FunctionSignature(nargs, classtype, const_func):
@@ -101,11 +102,111 @@ def FunctionSignature(nargs, classtype, const_func):
          nargs > 0 and 'args' or '',
          classtype and '(self.*function)'
                     or '(*function)'))
-        
+
+    const = const_func and 'const ' or ''
+    sigfile.write(
+        '\n' +
+        '\tstatic ResultType Invoke(const FunctionType &function, void *%s, void *const *%s)\n' %
+            (classtype and 'object' or '', nargs > 0 and 'args' or '') +
+        '\t{\n' +
+        (classtype and '\t\t%sClassType &self = *translucent_cast<%sClassType *>(object);\n' % (const, const) or '') +
+        '\t\treturn %s(%s);\n' % (
+            classtype and '(self.*function)' or '(*function)',
+            ','.join(['\n\t\t\t*static_cast<typename P%d::Type *>(args[%d])' % (i, i) for i in range(0, nargs)])) +
+        '\t}\n')
+
 
     def end(): sigfile.write('};\n\n')
     return end
 
+def Invoker(nargs):
+    out = invokerfile
+    params = ['A%d' % arg for arg in range(0, nargs)]
+    typed = ', '.join(['A%d a%d' % (arg, arg) for arg in range(0, nargs)])
+    values = ', '.join(['a%d' % arg for arg in range(0, nargs)])
+
+    out.write('template<typename ResultType%s>\n' % ''.join([', typename ' + p for p in params]))
+    out.write('class Invoker<ResultType (%s)>\n{\npublic:\n' % ', '.join(params))
+    out.write('\ttypedef typename InvokeResult<ResultType>::Value Result;\n\n')
+    out.write(
+        '\tInvoker(const Function *function = 0)\n' +
+        '\t\t: mFunction(0)\n' +
+        '\t\t, mInvoke(0)\n' +
+        '\t{\n' +
+        '\t\tBind(function);\n' +
+        '\t}\n\n')
+
+    if nargs > 0:
+        types = (
+            '\t\tconst Type *parameter_types[] =\n\t\t{\n' +
+            ',\n'.join(['\t\t\tTypeOf<typename ParameterHelper<%s>::Type>()' % p for p in params]) +
+            '\n\t\t};\n' +
+            '\t\tconst unsigned mutable_parameters = 0\n' +
+            ''.join(['\t\t\t| (ParameterHelper<A%d>::MutableParameter ? 1u << %d : 0)\n' % (arg, arg)
+                     for arg in range(0, nargs)]) +
+            '\t\t\t;\n\n')
+    else:
+        types = (
+            '\t\tconst Type *const *parameter_types = 0;\n' +
+            '\t\tconst unsigned mutable_parameters = 0;\n\n')
+
+    out.write(
+        '\t// Function: Bind\n' +
+        '\t// Calls *function* from now on, if its signature matches.\n' +
+        '\tbool Bind(const Function *function)\n' +
+        '\t{\n' +
+        types +
+        '\t\tmInvoke = function\n' +
+        '\t\t\t? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, %d, mutable_parameters)\n' % nargs +
+        '\t\t\t: 0;\n' +
+        '\t\tmFunction = mInvoke ? function : 0;\n' +
+        '\t\treturn 0 != mInvoke;\n' +
+        '\t}\n\n')
+
+    out.write(
+        '\t// Function: Valid\n' +
+        '\t// True when bound to a function with this signature.\n' +
+        '\tbool Valid() const { return 0 != mInvoke; }\n\n' +
+        '\tconst Function *GetFunction() const { return mFunction; }\n\n')
+
+    args = nargs > 0 and (
+        '\t\t\tvoid *const args[] = { %s };\n' %
+            ', '.join(['InvokeArgument(a%d)' % arg for arg in range(0, nargs)])) or ''
+    args_name = nargs > 0 and 'args' or '0'
+
+    out.write(
+        '\t// Function: operator() (method)\n' +
+        '\ttemplate<typename ClassType>\n' +
+        '\tResult operator()(ClassType *object%s) const\n' % (nargs > 0 and ', ' + typed or '') +
+        '\t{\n' +
+        '\t\tInvokeResult<ResultType> result;\n\n' +
+        '\t\tif(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)\n' +
+        '\t\t{\n' +
+        args +
+        '\t\t\tmInvoke(mFunction, self, %s, result.Address());\n' % args_name +
+        '\t\t}\n\n' +
+        '\t\treturn result.Get();\n' +
+        '\t}\n\n')
+
+    out.write(
+        '\t// Function: operator() (function)\n' +
+        '\tResult operator()(%s) const\n' % typed +
+        '\t{\n' +
+        '\t\tInvokeResult<ResultType> result;\n\n' +
+        '\t\tif(mInvoke && !mFunction->IsMethod())\n' +
+        '\t\t{\n' +
+        args +
+        '\t\t\tmInvoke(mFunction, 0, %s, result.Address());\n' % args_name +
+        '\t\t}\n\n' +
+        '\t\treturn result.Get();\n' +
+        '\t}\n\n')
+
+    out.write(
+        'private:\n' +
+        '\tconst Function *mFunction;\n' +
+        '\tFunction::InvokeFunction mInvoke;\n' +
+        '};\n\n')
+
 class Stack:
     def __init__(self, *args, **kwargs):
         self.stack = []
@@ -124,27 +225,26 @@ stack = Stack()
 
 stack.begin()
 stack.add(sigfile.close)
-stack.add(Guard('REFLECT_FUNCTION_FUNCTIONSIGNATURE_HPP_'))
+stack.add(Guard(sigfile, 'REFLECT_FUNCTION_FUNCTIONSIGNATURE_HPP_'))
 
 sigfile.write("""
 #include <reflect/Variant.h>
 
 """[1:])
 
-stack.add(Namespaces('reflect', 'function'))
+stack.add(Namespaces(sigfile, 'reflect', 'function'))
 
 sigfile.write(
 """
 // File: FunctionSignature.hpp
-// Autogenerated template bindings for reflecting functions in a generic way.
+// Generated template bindings for reflecting functions.
 //
-// This is the first stage in creating a generic run-time interface for functions,
+// This is the first stage in creating a run-time interface for functions,
 // it takes the inconsistent compile-time interface of function calls, and 
-// makes it into a consistent compile-time interface.
+// makes it into a more consistent (if awkward) templated compile-time interface.
 //
 // The second stage is in reflect/function/Function.hpp which
-// takes the compile-time consistent (template) interface and
-// makes it run-time consistent.
+// takes the template interface and wraps it in virtual functions.
 //
 // The third stage is in reflect/function/Function.{h,cpp} which defines the
 // run-time interface and provides some wrappers.
@@ -244,6 +344,110 @@ stack.end()
 
 assert(sigfile.closed)
 
+stack.begin()
+stack.add(invokerfile.close)
+stack.add(Guard(invokerfile, 'REFLECT_FUNCTION_INVOKER_HPP_'))
+
+invokerfile.write("""
+#include <reflect/function/Function.h>
+#include <reflect/function/FunctionSignature.hpp>
+
+"""[1:])
+
+stack.add(Namespaces(invokerfile, 'reflect', 'function'))
+
+invokerfile.write(
+"""
+// File: Invoker.hpp
+// Generated typed calls of reflected functions, see <Invoker>.
+
+// Class: Invoker
+//
+// Calls a <Function> with a C++ signature known to the caller,
+// passing the arguments by address instead of through <Variant>s.
+//
+// The signature is checked once, by <Bind>, against the parameter
+// and result types of the function: they must be the same types
+// (a reference or const reference to the parameter type will do
+// for parameters passed by value, mutable parameters must be
+// non-const references).  A void result ignores the function's result.
+//
+// Calls of an invoker which isn't <Valid>, or methods called with an
+// object which does not derive from the function's class (or a const
+// object for a non-const method) do nothing and return a default result.
+//
+// Usage:
+// (code)
+// function::Invoker<double (int, float)> scale(clazz->FindFunction("Scale"));
+// if(scale.Valid())
+//     for(each object)
+//         total += scale(object, 1, 2.f);
+// (end)
+template<typename FunctionType> class Invoker;
+
+// Struct: InvokeResult
+// Holds the result of an <Invoker> call.
+template<typename ResultType>
+struct InvokeResult
+{
+	typedef typename ParameterHelper<ResultType>::Type Value;
+
+	InvokeResult() : value() {}
+
+	static const Type *GetType() { return TypeOf<Value>(); }
+	void *Address() { return &value; }
+	Value Get() const { return value; }
+
+	Value value;
+};
+
+template<>
+struct InvokeResult<void>
+{
+	typedef void Value;
+
+	static const Type *GetType() { return 0; }
+	void *Address() { return 0; }
+	void Get() const {}
+};
+
+template<typename T>
+inline void *InvokeArgument(const T &value)
+{
+	return const_cast<T *>(&value);
+}
+
+template<typename T>
+inline void *InvokeSelf(const Function *function, T *object)
+{
+	return object && function->IsMethod() && TypeOf<T>()->DerivesType(function->CallObjectType())
+		? opaque_cast(object)
+		: 0;
+}
+
+template<typename T>
+inline void *InvokeSelf(const Function *function, const T *object)
+{
+	return object && function->IsConstMethod() && TypeOf<T>()->DerivesType(function->CallObjectType())
+		? const_cast<void *>(opaque_cast(object))
+		: 0;
+}
+
+template<typename FunctionType>
+inline Invoker<FunctionType> Function::Invoke() const
+{
+	return Invoker<FunctionType>(this);
+}
+
+"""[1:])
+
+for i in range(0,16):
+    Invoker(i)
+
+stack.end()
+
+assert(invokerfile.closed)
+
 #sigfile = file(sigfile.name, 'r')
 #for line in sigfile:
 #   print line,
@@ -0,0 +1,1456 @@
+#ifndef REFLECT_FUNCTION_INVOKER_HPP_
+#define REFLECT_FUNCTION_INVOKER_HPP_
+
+#include <reflect/function/Function.h>
+#include <reflect/function/FunctionSignature.hpp>
+
+namespace reflect { namespace function {
+
+// File: Invoker.hpp
+// Generated typed calls of reflected functions, see <Invoker>.
+
+// Class: Invoker
+//
+// Calls a <Function> with a C++ signature known to the caller,
+// passing the arguments by address instead of through <Variant>s.
+//
+// The signature is checked once, by <Bind>, against the parameter
+// and result types of the function: they must be the same types
+// (a reference or const reference to the parameter type will do
+// for parameters passed by value, mutable parameters must be
+// non-const references).  A void result ignores the function's result.
+//
+// Calls of an invoker which isn't <Valid>, or methods called with an
+// object which does not derive from the function's class (or a const
+// object for a non-const method) do nothing and return a default result.
+//
+// Usage:
+// (code)
+// function::Invoker<double (int, float)> scale(clazz->FindFunction("Scale"));
+// if(scale.Valid())
+//     for(each object)
+//         total += scale(object, 1, 2.f);
+// (end)
+template<typename FunctionType> class Invoker;
+
+// Struct: InvokeResult
+// Holds the result of an <Invoker> call.
+template<typename ResultType>
+struct InvokeResult
+{
+	typedef typename ParameterHelper<ResultType>::Type Value;
+
+	InvokeResult() : value() {}
+
+	static const Type *GetType() { return TypeOf<Value>(); }
+	void *Address() { return &value; }
+	Value Get() const { return value; }
+
+	Value value;
+};
+
+template<>
+struct InvokeResult<void>
+{
+	typedef void Value;
+
+	static const Type *GetType() { return 0; }
+	void *Address() { return 0; }
+	void Get() const {}
+};
+
+template<typename T>
+inline void *InvokeArgument(const T &value)
+{
+	return const_cast<T *>(&value);
+}
+
+// the usual call is on the method's own class, which is one compare.
+template<typename T>
+inline bool InvokesOn(const Function *function)
+{
+	const Type *type = TypeOf<T>();
+
+	return type == function->CallObjectType() || type->DerivesType(function->CallObjectType());
+}
+
+template<typename T>
+inline void *InvokeSelf(const Function *function, T *object)
+{
+	return object && function->IsMethod() && InvokesOn<T>(function)
+		? opaque_cast(object)
+		: 0;
+}
+
+template<typename T>
+inline void *InvokeSelf(const Function *function, const T *object)
+{
+	return object && function->IsConstMethod() && InvokesOn<T>(function)
+		? const_cast<void *>(opaque_cast(object))
+		: 0;
+}
+
+template<typename FunctionType>
+inline Invoker<FunctionType> Function::Invoke() const
+{
+	return Invoker<FunctionType>(this);
+}
+
+template<typename ResultType>
+class Invoker<ResultType ()>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *const *parameter_types = 0;
+		const unsigned mutable_parameters = 0;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 0, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			mInvoke(mFunction, self, 0, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()() const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			mInvoke(mFunction, 0, 0, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0>
+class Invoker<ResultType (A0)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 1, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1>
+class Invoker<ResultType (A0, A1)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 2, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2>
+class Invoker<ResultType (A0, A1, A2)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 3, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3>
+class Invoker<ResultType (A0, A1, A2, A3)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 4, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4>
+class Invoker<ResultType (A0, A1, A2, A3, A4)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 5, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 6, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 7, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 8, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7, A8)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>(),
+			TypeOf<typename ParameterHelper<A8>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			| (ParameterHelper<A8>::MutableParameter ? 1u << 8 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 9, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>(),
+			TypeOf<typename ParameterHelper<A8>::Type>(),
+			TypeOf<typename ParameterHelper<A9>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			| (ParameterHelper<A8>::MutableParameter ? 1u << 8 : 0)
+			| (ParameterHelper<A9>::MutableParameter ? 1u << 9 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 10, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>(),
+			TypeOf<typename ParameterHelper<A8>::Type>(),
+			TypeOf<typename ParameterHelper<A9>::Type>(),
+			TypeOf<typename ParameterHelper<A10>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			| (ParameterHelper<A8>::MutableParameter ? 1u << 8 : 0)
+			| (ParameterHelper<A9>::MutableParameter ? 1u << 9 : 0)
+			| (ParameterHelper<A10>::MutableParameter ? 1u << 10 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 11, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>(),
+			TypeOf<typename ParameterHelper<A8>::Type>(),
+			TypeOf<typename ParameterHelper<A9>::Type>(),
+			TypeOf<typename ParameterHelper<A10>::Type>(),
+			TypeOf<typename ParameterHelper<A11>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			| (ParameterHelper<A8>::MutableParameter ? 1u << 8 : 0)
+			| (ParameterHelper<A9>::MutableParameter ? 1u << 9 : 0)
+			| (ParameterHelper<A10>::MutableParameter ? 1u << 10 : 0)
+			| (ParameterHelper<A11>::MutableParameter ? 1u << 11 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 12, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>(),
+			TypeOf<typename ParameterHelper<A8>::Type>(),
+			TypeOf<typename ParameterHelper<A9>::Type>(),
+			TypeOf<typename ParameterHelper<A10>::Type>(),
+			TypeOf<typename ParameterHelper<A11>::Type>(),
+			TypeOf<typename ParameterHelper<A12>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			| (ParameterHelper<A8>::MutableParameter ? 1u << 8 : 0)
+			| (ParameterHelper<A9>::MutableParameter ? 1u << 9 : 0)
+			| (ParameterHelper<A10>::MutableParameter ? 1u << 10 : 0)
+			| (ParameterHelper<A11>::MutableParameter ? 1u << 11 : 0)
+			| (ParameterHelper<A12>::MutableParameter ? 1u << 12 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 13, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11), InvokeArgument(a12) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11), InvokeArgument(a12) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>(),
+			TypeOf<typename ParameterHelper<A8>::Type>(),
+			TypeOf<typename ParameterHelper<A9>::Type>(),
+			TypeOf<typename ParameterHelper<A10>::Type>(),
+			TypeOf<typename ParameterHelper<A11>::Type>(),
+			TypeOf<typename ParameterHelper<A12>::Type>(),
+			TypeOf<typename ParameterHelper<A13>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			| (ParameterHelper<A8>::MutableParameter ? 1u << 8 : 0)
+			| (ParameterHelper<A9>::MutableParameter ? 1u << 9 : 0)
+			| (ParameterHelper<A10>::MutableParameter ? 1u << 10 : 0)
+			| (ParameterHelper<A11>::MutableParameter ? 1u << 11 : 0)
+			| (ParameterHelper<A12>::MutableParameter ? 1u << 12 : 0)
+			| (ParameterHelper<A13>::MutableParameter ? 1u << 13 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 14, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11), InvokeArgument(a12), InvokeArgument(a13) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11), InvokeArgument(a12), InvokeArgument(a13) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+template<typename ResultType, typename A0, typename A1, typename A2, typename A3, typename A4, typename A5, typename A6, typename A7, typename A8, typename A9, typename A10, typename A11, typename A12, typename A13, typename A14>
+class Invoker<ResultType (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
+{
+public:
+	typedef typename InvokeResult<ResultType>::Value Result;
+
+	Invoker(const Function *function = 0)
+		: mFunction(0)
+		, mInvoke(0)
+	{
+		Bind(function);
+	}
+
+	// Function: Bind
+	// Calls *function* from now on, if its signature matches.
+	bool Bind(const Function *function)
+	{
+		const Type *parameter_types[] =
+		{
+			TypeOf<typename ParameterHelper<A0>::Type>(),
+			TypeOf<typename ParameterHelper<A1>::Type>(),
+			TypeOf<typename ParameterHelper<A2>::Type>(),
+			TypeOf<typename ParameterHelper<A3>::Type>(),
+			TypeOf<typename ParameterHelper<A4>::Type>(),
+			TypeOf<typename ParameterHelper<A5>::Type>(),
+			TypeOf<typename ParameterHelper<A6>::Type>(),
+			TypeOf<typename ParameterHelper<A7>::Type>(),
+			TypeOf<typename ParameterHelper<A8>::Type>(),
+			TypeOf<typename ParameterHelper<A9>::Type>(),
+			TypeOf<typename ParameterHelper<A10>::Type>(),
+			TypeOf<typename ParameterHelper<A11>::Type>(),
+			TypeOf<typename ParameterHelper<A12>::Type>(),
+			TypeOf<typename ParameterHelper<A13>::Type>(),
+			TypeOf<typename ParameterHelper<A14>::Type>()
+		};
+		const unsigned mutable_parameters = 0
+			| (ParameterHelper<A0>::MutableParameter ? 1u << 0 : 0)
+			| (ParameterHelper<A1>::MutableParameter ? 1u << 1 : 0)
+			| (ParameterHelper<A2>::MutableParameter ? 1u << 2 : 0)
+			| (ParameterHelper<A3>::MutableParameter ? 1u << 3 : 0)
+			| (ParameterHelper<A4>::MutableParameter ? 1u << 4 : 0)
+			| (ParameterHelper<A5>::MutableParameter ? 1u << 5 : 0)
+			| (ParameterHelper<A6>::MutableParameter ? 1u << 6 : 0)
+			| (ParameterHelper<A7>::MutableParameter ? 1u << 7 : 0)
+			| (ParameterHelper<A8>::MutableParameter ? 1u << 8 : 0)
+			| (ParameterHelper<A9>::MutableParameter ? 1u << 9 : 0)
+			| (ParameterHelper<A10>::MutableParameter ? 1u << 10 : 0)
+			| (ParameterHelper<A11>::MutableParameter ? 1u << 11 : 0)
+			| (ParameterHelper<A12>::MutableParameter ? 1u << 12 : 0)
+			| (ParameterHelper<A13>::MutableParameter ? 1u << 13 : 0)
+			| (ParameterHelper<A14>::MutableParameter ? 1u << 14 : 0)
+			;
+
+		mInvoke = function
+			? function->FindInvoke(InvokeResult<ResultType>::GetType(), parameter_types, 15, mutable_parameters)
+			: 0;
+		mFunction = mInvoke ? function : 0;
+		return 0 != mInvoke;
+	}
+
+	// Function: Valid
+	// True when bound to a function with this signature.
+	bool Valid() const { return 0 != mInvoke; }
+
+	const Function *GetFunction() const { return mFunction; }
+
+	// Function: operator() (method)
+	template<typename ClassType>
+	Result operator()(ClassType *object, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(void *self = mInvoke ? InvokeSelf(mFunction, object) : 0)
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11), InvokeArgument(a12), InvokeArgument(a13), InvokeArgument(a14) };
+			mInvoke(mFunction, self, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+	// Function: operator() (function)
+	Result operator()(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) const
+	{
+		InvokeResult<ResultType> result;
+
+		if(mInvoke && !mFunction->IsMethod())
+		{
+			void *const args[] = { InvokeArgument(a0), InvokeArgument(a1), InvokeArgument(a2), InvokeArgument(a3), InvokeArgument(a4), InvokeArgument(a5), InvokeArgument(a6), InvokeArgument(a7), InvokeArgument(a8), InvokeArgument(a9), InvokeArgument(a10), InvokeArgument(a11), InvokeArgument(a12), InvokeArgument(a13), InvokeArgument(a14) };
+			mInvoke(mFunction, 0, args, result.Address());
+		}
+
+		return result.Get();
+	}
+
+private:
+	const Function *mFunction;
+	Function::InvokeFunction mInvoke;
+};
+
+} }
+
+#endif // REFLECT_FUNCTION_INVOKER_HPP_
@@ -40,7 +40,13 @@ public:
 	// virtual
     bool RefData(const void *in, void *out, Variant &value) const;
 
+	// virtual
+	bool GetDirectAccess(DirectAccess &access) const;
+
 private:
+	static const void *Get(const DataProperty *property, const void *object);
+	static void Set(const DataProperty *property, void *object, const void *value);
+
 	// Member: mGetter
     const MemberType &(ObjectType::*mGetter)() const;
 
@@ -72,6 +72,28 @@ bool AccessorDirectProperty<ObjectType, MemberType>::RefData(
 	else return false;
 }
 
+template<typename ObjectType, typename MemberType>
+bool AccessorDirectProperty<ObjectType, MemberType>::GetDirectAccess(DirectAccess &access) const
+{
+	access.get = &Get;
+	access.set = &Set;
+	return true;
+}
+
+template<typename ObjectType, typename MemberType>
+const void *AccessorDirectProperty<ObjectType, MemberType>::Get(const DataProperty *property, const void *object)
+{
+	const AccessorDirectProperty *self = static_cast<const AccessorDirectProperty *>(property);
+	return &(translucent_cast<const ObjectType *>(object)->*self->mGetter)();
+}
+
+template<typename ObjectType, typename MemberType>
+void AccessorDirectProperty<ObjectType, MemberType>::Set(const DataProperty *property, void *object, const void *value)
+{
+	const AccessorDirectProperty *self = static_cast<const AccessorDirectProperty *>(property);
+	(translucent_cast<ObjectType *>(object)->*self->mSetter)(*static_cast<const MemberType *>(value));
+}
+
 } }
 
 #endif
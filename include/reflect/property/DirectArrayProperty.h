@@ -30,6 +30,9 @@ public:
 	// virtual
 	Type *ItemType() const;
 
+	// virtual
+	void *ItemData(const void *in, void *out) const;
+
 	// virtual
 	bool ReadData(const void *in, unsigned index, Variant &variant) const;
 
@@ -51,6 +51,20 @@ Type *DirectArrayProperty<ObjectType, MemberType>::ItemType() const
 	return TypeOf<MemberType>();
 }
 
+template<typename ObjectType, typename MemberType>
+void *DirectArrayProperty<ObjectType, MemberType>::ItemData(const void *in, void *out) const
+{
+	if(out)
+	{
+		return translucent_cast<ObjectType *>(out)->*mMember;
+	}
+	else if(in)
+	{
+		return const_cast<MemberType *>(translucent_cast<const ObjectType *>(in)->*mMember);
+	}
+	else return 0;
+}
+
 template<typename ObjectType, typename MemberType>
 bool DirectArrayProperty<ObjectType, MemberType>::ReadData(const void *obj, unsigned index, Variant &variant) const
 {
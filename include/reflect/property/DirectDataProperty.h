@@ -31,7 +31,13 @@ public:
 	// virtual
     void Serialize(const void *in, void *out, Reflector &reflector) const;
 
+	// virtual
+	bool GetDirectAccess(DirectAccess &access) const;
+
 private:
+	static const void *Get(const DataProperty *property, const void *object);
+	static void Set(const DataProperty *property, void *object, const void *value);
+
 	// Member: mMember
     MemberType ObjectType::*mMember;
 };
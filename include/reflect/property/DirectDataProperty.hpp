@@ -55,6 +55,28 @@ bool DirectDataProperty<ObjectType, MemberType>::RefData(
 	else return false;
 }
 
+template<typename ObjectType, typename MemberType>
+bool DirectDataProperty<ObjectType, MemberType>::GetDirectAccess(DirectAccess &access) const
+{
+	access.get = &Get;
+	access.set = &Set;
+	return true;
+}
+
+template<typename ObjectType, typename MemberType>
+const void *DirectDataProperty<ObjectType, MemberType>::Get(const DataProperty *property, const void *object)
+{
+	const DirectDataProperty *self = static_cast<const DirectDataProperty *>(property);
+	return &(translucent_cast<const ObjectType *>(object)->*self->mMember);
+}
+
+template<typename ObjectType, typename MemberType>
+void DirectDataProperty<ObjectType, MemberType>::Set(const DataProperty *property, void *object, const void *value)
+{
+	const DirectDataProperty *self = static_cast<const DirectDataProperty *>(property);
+	translucent_cast<ObjectType *>(object)->*self->mMember = *static_cast<const MemberType *>(value);
+}
+
 } }
 
 #endif
@@ -0,0 +1,34 @@
+#ifndef REFLECT_PROPERTY_DIRECTFRAGMENTVIEWPROPERTY_H_
+#define REFLECT_PROPERTY_DIRECTFRAGMENTVIEWPROPERTY_H_
+
+#include <reflect/property/DirectDataProperty.h>
+#include <reflect/string/Fragment.h>
+
+namespace reflect { namespace property {
+
+// Class: DirectFragmentViewProperty
+//
+// A <DirectDataProperty> for a <string::Fragment> member which,
+// when the deserializer offers a <Deserializer::DeserializeTextView>,
+// points the member straight into the input instead of interning it.
+//
+// The object must not outlive the input it was loaded from
+// (e.g. the <utility::MappedFileInputStream>), otherwise this
+// deserializes like any other fragment.
+template<typename ObjectType>
+class DirectFragmentViewProperty : public DirectDataProperty<ObjectType, string::Fragment>
+{
+public:
+    DirectFragmentViewProperty(string::Fragment ObjectType::*);
+
+	// virtual
+    void Serialize(const void *in, void *out, Reflector &reflector) const;
+
+private:
+	// Member: mMember
+    string::Fragment ObjectType::*mMember;
+};
+
+} }
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef REFLECT_PROPERTY_DIRECTFRAGMENTVIEWPROPERTY_HPP_
+#define REFLECT_PROPERTY_DIRECTFRAGMENTVIEWPROPERTY_HPP_
+
+#include <reflect/property/DirectFragmentViewProperty.h>
+#include <reflect/property/DirectDataProperty.hpp>
+#include <reflect/Deserializer.h>
+#include <reflect/Reflector.h>
+
+namespace reflect { namespace property {
+
+template<typename ObjectType>
+DirectFragmentViewProperty<ObjectType>::DirectFragmentViewProperty(string::Fragment ObjectType::*member)
+    : DirectDataProperty<ObjectType, string::Fragment>(member)
+    , mMember(member)
+{
+}
+
+template<typename ObjectType>
+void DirectFragmentViewProperty<ObjectType>::Serialize(const void *in, void *out, Reflector &reflector) const
+{
+	if(reflector.Deserializing())
+	{
+		Deserializer &deserializer = reflector;
+		string::Fragment view;
+
+		if(deserializer.DeserializeTextView(view))
+		{
+			translucent_cast<ObjectType *>(out)->*mMember = view;
+			return;
+		}
+	}
+
+    DirectDataProperty<ObjectType, string::Fragment>::Serialize(in, out, reflector);
+}
+
+} }
+
+#endif
@@ -3,9 +3,28 @@
 
 #include <reflect/property/DirectVectorProperty.h>
 #include <reflect/Reflector.h>
+#include <vector>
 
 namespace reflect { namespace property {
 
+namespace internals {
+
+// only std::vector keeps its items contiguous.
+template<typename MemberType>
+struct VectorItems
+{
+	static const void *Data(const MemberType &) { return 0; }
+};
+
+template<typename ItemType, typename Allocator>
+struct VectorItems<std::vector<ItemType, Allocator> >
+{
+	static const void *Data(const std::vector<ItemType, Allocator> &items)
+	{ return items.empty() ? 0 : &items[0]; }
+};
+
+}
+
 template<typename ObjectType, typename MemberType>
 DirectVectorProperty<ObjectType, MemberType>::DirectVectorProperty(MemberType ObjectType::*member)
     : mMember(member)
@@ -51,6 +70,18 @@ Type *DirectVectorProperty<ObjectType, MemberType>::ItemType() const
 	return TypeOf<typename MemberType::value_type>();
 }
 
+template<typename ObjectType, typename MemberType>
+void *DirectVectorProperty<ObjectType, MemberType>::ItemData(const void *in, void *out) const
+{
+	const ObjectType *object = out
+		? translucent_cast<ObjectType *>(out)
+		: translucent_cast<const ObjectType *>(in);
+
+	return object
+		? const_cast<void *>(internals::VectorItems<MemberType>::Data(object->*mMember))
+		: 0;
+}
+
 template<typename ObjectType, typename MemberType>
 bool DirectVectorProperty<ObjectType, MemberType>::ReadData(const void *in, unsigned index, Variant &value) const
 {
@@ -0,0 +1,46 @@
+#ifndef REFLECT_SERIALIZE_ARRAYELEMENT_H_
+#define REFLECT_SERIALIZE_ARRAYELEMENT_H_
+
+#include <reflect/config/config.h>
+
+namespace reflect {
+class Type;
+}
+
+namespace reflect { namespace serialize {
+
+// Enumeration: ArrayElement
+//
+// The primitive types <Serializer.SerializeArray> and
+// <Deserializer.DeserializeArray> handle in bulk.
+//
+// <BinarySerializer> stores these values, so they must not be renumbered.
+enum ArrayElement
+{
+	NoArrayElement = 0,
+	BoolElement = 1,
+	CharElement = 2,
+	SignedCharElement = 3,
+	UnsignedCharElement = 4,
+	ShortElement = 5,
+	UnsignedShortElement = 6,
+	IntElement = 7,
+	UnsignedIntElement = 8,
+	LongElement = 9,
+	UnsignedLongElement = 10,
+	FloatElement = 11,
+	DoubleElement = 12
+};
+
+// Function: ArrayElementOf
+// The <ArrayElement> for *type*, or NoArrayElement if it is not
+// one of the primitive types (see <PrimitiveTypes.h>).
+ReflectExport(reflect) ArrayElement ArrayElementOf(const Type *type);
+
+// Function: ArrayElementSize
+// sizeof the element's C++ type.
+ReflectExport(reflect) unsigned ArrayElementSize(ArrayElement element);
+
+} }
+
+#endif
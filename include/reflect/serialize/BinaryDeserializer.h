@@ -0,0 +1,78 @@
+#ifndef REFLECT_SERIALIZE_BINARYDESERIALIZER_H_
+#define REFLECT_SERIALIZE_BINARYDESERIALIZER_H_
+
+#include <reflect/Deserializer.h>
+#include <reflect/serialize/BinaryFormat.h>
+#include <reflect/serialize/ClassCache.h>
+#include <reflect/BufferedInputStream.h>
+#include <vector>
+
+#include <reflect/config/config.h>
+
+namespace reflect { namespace serialize {
+
+// Class: BinaryDeserializer
+//     Reads the format written by <BinarySerializer>.
+//
+// Numbers are accepted across signed, unsigned and double codes,
+// and <End> skips over any tokens it does not expect.
+//
+// See Also:
+//     - <Deserializer>
+//     - <BinarySerializer>
+class ReflectExport(reflect) BinaryDeserializer : public Deserializer
+{
+public:
+	// Constructor: BinaryDeserializer(InputStream &)
+	// Reads the stream without reading ahead of what it deserializes
+	// (but for a byte peeked at), so the rest can be read by others.
+	BinaryDeserializer(InputStream &);
+
+	// Constructor: BinaryDeserializer(BufferedInputStream &)
+	// Reads directly out of the stream's window, without buffering it again.
+	BinaryDeserializer(BufferedInputStream &);
+
+protected:
+	/*virtual*/ bool Begin(SerializationTag &, SerializationTag::TagType = SerializationTag::UnknownTag);
+	/*virtual*/ bool End(SerializationTag &);
+
+	/*virtual*/ bool Deserialize(bool &);
+	/*virtual*/ bool Deserialize(long &);
+	/*virtual*/ bool Deserialize(unsigned long &);
+	/*virtual*/ bool Deserialize(double &);
+	/*virtual*/ bool Deserialize(Dynamic *&object);
+	/*virtual*/ bool Reference(Dynamic *object);
+	/*virtual*/ bool DeserializeTextChunk(char *text, unsigned &max_bytes, bool &complete);
+	/*virtual*/ bool DeserializeTextView(string::Fragment &text);
+	/*virtual*/ bool DeserializeData(void *data, unsigned nbytes);
+	/*virtual*/ bool DeserializeEnum(int &value, const EnumType *clazz);
+	/*virtual*/ bool DeserializeProperty(void *object, const Property *prop);
+
+	// Function: DeserializeArray
+	// Reads a <BinaryArray>, converting the items if they were written as
+	// another <ArrayElement>.  Items written one at a time are read as the
+	// <Deserializer> does.
+	/*virtual*/ bool DeserializeArray(const Type *type, void *data, unsigned count);
+
+private:
+	std::vector<Dynamic *> mReferenced;
+	ClassCache mClasses;
+	BufferedInputStream mBuffer;
+	BufferedInputStream &mInput;
+	bool mDeserializingText;
+	unsigned long mTextRemaining;
+
+	// returns -1 at the end of the stream.
+	int Peek();
+	int Read();
+	bool ReadBytes(void *data, unsigned long nbytes);
+	bool SkipBytes(unsigned long nbytes);
+	bool ReadVarint(unsigned long &value);
+	bool ReadName(char *buffer, unsigned capacity, unsigned &length);
+	bool ReadNumber(BinaryCode &code, unsigned long &bits, double &real);
+	bool Skip();
+};
+
+} }
+
+#endif
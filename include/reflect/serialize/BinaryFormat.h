@@ -0,0 +1,91 @@
+#ifndef REFLECT_SERIALIZE_BINARYFORMAT_H_
+#define REFLECT_SERIALIZE_BINARYFORMAT_H_
+
+#include <reflect/serialize/ArrayElement.h>
+
+namespace reflect { namespace serialize {
+
+// Enumeration: BinaryCode
+//
+// The leading byte of every token written by a <BinarySerializer>.
+//
+// Integers are written as LEB128 varints (signed values are zigzag encoded first),
+// doubles as 8 little-endian IEEE bytes, and names, text and data as a
+// varint length followed by the raw bytes.
+//
+//   BinaryEnd - ends the innermost open tag.
+//   BinaryObjectTag - starts an <SerializationTag::ObjectTag>, followed by a name.
+//   BinaryPropertyTag - starts a <SerializationTag::PropertyTag>, followed by a name.
+//   BinaryAttributeTag - starts a <SerializationTag::AttributeTag>, followed by a name.
+//   BinaryItemTag - starts a <SerializationTag::ItemTag>, no name.
+//   BinaryFalse, BinaryTrue - a bool.
+//   BinarySigned - a zigzag varint.
+//   BinaryUnsigned - a varint.
+//   BinaryDouble - 8 bytes.
+//   BinaryEnum - a zigzag varint.
+//   BinaryText - a length prefixed string.
+//   BinaryData - a length prefixed block of data.
+//   BinaryArray - a varint count, an <ArrayElement> byte and count fixed width
+//                 little-endian items, see <BinaryArrayWidth>.
+//   BinaryNull - a null <Dynamic> pointer.
+//   BinaryObject - a class name followed by the object's pointer serialization.
+//   BinaryBackReference - a varint index of a previously referenced object.
+//   BinaryReference - a varint index assigned to the object being deserialized.
+enum BinaryCode
+{
+	BinaryEnd = 0x00,
+
+	BinaryObjectTag = 0x01,
+	BinaryPropertyTag = 0x02,
+	BinaryAttributeTag = 0x03,
+	BinaryItemTag = 0x04,
+
+	BinaryFalse = 0x10,
+	BinaryTrue = 0x11,
+	BinarySigned = 0x12,
+	BinaryUnsigned = 0x13,
+	BinaryDouble = 0x14,
+	BinaryEnum = 0x15,
+	BinaryText = 0x16,
+	BinaryData = 0x17,
+	BinaryArray = 0x18,
+
+	BinaryNull = 0x20,
+	BinaryObject = 0x21,
+	BinaryBackReference = 0x22,
+	BinaryReference = 0x23
+};
+
+// Function: BinaryArrayWidth
+// The number of bytes stored per item of a <BinaryArray>,
+// independent of the platform's sizeof, or 0 for NoArrayElement.
+inline unsigned BinaryArrayWidth(ArrayElement element)
+{
+	switch(element)
+	{
+	case BoolElement:
+	case CharElement:
+	case SignedCharElement:
+	case UnsignedCharElement:
+		return 1;
+	case ShortElement:
+	case UnsignedShortElement:
+		return 2;
+	case IntElement:
+	case UnsignedIntElement:
+	case FloatElement:
+		return 4;
+	case LongElement:
+	case UnsignedLongElement:
+	case DoubleElement:
+		return 8;
+	case NoArrayElement:
+		break;
+	}
+
+	return 0;
+}
+
+} }
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef REFLECT_SERIALIZE_BINARYSERIALIZER_H_
+#define REFLECT_SERIALIZE_BINARYSERIALIZER_H_
+
+#include <reflect/Serializer.h>
+#include <reflect/serialize/BinaryFormat.h>
+#include <reflect/config/config.h>
+#include <reflect/utility/PointerMap.hpp>
+
+namespace reflect {
+class OutputStream;
+}
+
+namespace reflect { namespace serialize {
+
+// Class: BinarySerializer
+//     A compact binary serializer, see <BinaryCode> for the format.
+//
+// Every token is a single <OutputStream::Write>, no formatting is involved.
+//
+// See Also:
+//     - <Serializer>
+//     - <BinaryDeserializer>
+class ReflectExport(reflect) BinarySerializer : public Serializer
+{
+public:
+	BinarySerializer(OutputStream &stream);
+
+protected:
+	// Function: Begin
+	//   Writes the tag's code, followed by its text for all but item tags.
+	bool Begin(const SerializationTag &); /*virtual*/
+
+	// Function: End
+	//   Writes <BinaryEnd>.
+	bool End(const SerializationTag &); /*virtual*/
+
+	bool Serialize(bool); /*virtual*/
+	bool Serialize(long); /*virtual*/
+	bool Serialize(unsigned long); /*virtual*/
+	bool Serialize(double); /*virtual*/
+
+	// Function: Serialize(const Dynamic *obj)
+	//   Writes <BinaryObject> and the name of the class followed by the pointer,
+	// a <BinaryBackReference> to an object already referenced, or <BinaryNull>.
+	bool Serialize(const Dynamic *object); /*virtual*/
+
+	// Function: Reference(const Dynamic *object)
+	//   Writes <BinaryReference> with the number of references made so far.
+	bool Reference(const Dynamic *object); /*virtual*/
+
+	// Function: Reserve
+	//   Sizes the reference table for *objects* referenced objects.
+	void Reserve(unsigned objects); /*virtual*/
+
+	bool SerializeText(const char *text, unsigned nbytes); /*virtual*/
+	bool SerializeData(const void *data, unsigned nbytes); /*virtual*/
+
+	// Function: SerializeEnum
+	//    Writes the enum's integer value, the names are not stored.
+	bool SerializeEnum(int value, const EnumType *clazz); /*virtual*/
+
+	bool SerializeProperty(const void *object, const Property *prop); /*virtual*/
+
+	// Function: SerializeArray
+	//    Writes a <BinaryArray>, copying the items straight to the stream
+	// when their layout matches the format.
+	bool SerializeArray(const Type *type, const void *data, unsigned count); /*virtual*/
+
+protected:
+	bool WriteCode(BinaryCode code);
+	bool WriteVarint(BinaryCode code, unsigned long value);
+	bool WriteBlock(BinaryCode code, const void *data, unsigned nbytes);
+
+private:
+	int mNextIndex;
+	utility::PointerMap<int> mReferenced;
+	OutputStream &mStream;
+};
+
+} }
+
+#endif
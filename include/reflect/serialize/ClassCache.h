@@ -0,0 +1,51 @@
+#ifndef REFLECT_SERIALIZE_CLASSCACHE_H_
+#define REFLECT_SERIALIZE_CLASSCACHE_H_
+
+#include <reflect/string/Fragment.h>
+#include <reflect/string/String.h>
+#include <reflect/config/config.h>
+#include <vector>
+
+namespace reflect {
+
+class Class;
+
+namespace serialize {
+
+// Class: ClassCache
+//
+// Resolves the class names read by a deserializer, remembering
+// each name's class (or its absence) so a stream which repeats an
+// object type looks it up once.
+//
+// Names are matched by their bytes, a hit costs a hash of the name
+// and a compare, with no string pool search or autocast.
+class ReflectExport(reflect) ClassCache
+{
+public:
+	ClassCache();
+
+	// Function: Find
+	// The class named *name*, or NULL if there is none.
+	Class *Find(const string::Fragment &name);
+
+private:
+	struct Entry
+	{
+		Entry() : hash(0), clazz(0), used(false) {}
+
+		unsigned hash;
+		string::String name;
+		Class *clazz;
+		bool used;
+	};
+
+	void Grow();
+
+	std::vector<Entry> mEntries;
+	std::size_t mSize;
+};
+
+} }
+
+#endif
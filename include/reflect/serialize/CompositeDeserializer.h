@@ -25,9 +25,11 @@ public:
     /*virtual*/ bool Deserialize(Dynamic *&object);
     /*virtual*/ bool Reference(Dynamic *object);
     /*virtual*/ bool DeserializeTextChunk(char *text, unsigned &max_bytes, bool &complete);
+    /*virtual*/ bool DeserializeTextView(string::Fragment &text);
     /*virtual*/ bool DeserializeData(void *data, unsigned nbytes);
     /*virtual*/ bool DeserializeEnum(int &value, const EnumType *);
 	/*virtual*/ bool DeserializeProperty(void *object, const Property *prop);
+	/*virtual*/ bool DeserializeArray(const Type *type, void *data, unsigned count);
 
 protected:
 	Deserializer &mDeserializer;
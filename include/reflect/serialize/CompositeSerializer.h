@@ -24,10 +24,12 @@ public:
     /*virtual*/ bool Serialize(double);
     /*virtual*/ bool Serialize(const Dynamic *object);
     /*virtual*/ bool Reference(const Dynamic *object);
+    /*virtual*/ void Reserve(unsigned objects);
     /*virtual*/ bool SerializeText(const char *text, unsigned nbytes);
     /*virtual*/ bool SerializeData(const void *data, unsigned nbytes);
     /*virtual*/ bool SerializeEnum(int value, const EnumType *);
 	/*virtual*/ bool SerializeProperty(const void *object, const Property *prop);
+	/*virtual*/ bool SerializeArray(const Type *type, const void *data, unsigned count);
 
 protected:
     ~CompositeSerializer();
@@ -0,0 +1,73 @@
+#ifndef REFLECT_SERIALIZE_NUMBERFORMAT_H_
+#define REFLECT_SERIALIZE_NUMBERFORMAT_H_
+
+#include <reflect/config/config.h>
+
+namespace reflect { namespace serialize {
+
+// Section: NumberFormat
+//
+// The text format's numeric codec, shared by <StandardSerializer>
+// and <StandardDeserializer>.
+//
+// Integers are formatted and parsed with digit loops instead of
+// going through printf/strtol, and doubles are written with the
+// fewest significant digits (at most 17) which parse back to exactly
+// the same value.  Those digits are found with integer arithmetic
+// (Grisu3), printf is only used for the few values it can't settle.
+//
+// The parsers accept everything strtol/strtoul/strtod accept
+// (leading zeros for octal, "inf", hex floats, ...), but only the
+// common forms are handled without falling back to the C library.
+
+// Constant: MaxNumberLength
+// Buffer size sufficient for any of the Format functions.
+enum { MaxNumberLength = 32 };
+
+// Function: FormatSigned
+// Writes *value* in decimal, e.g., -3 -> "-3".
+//
+// Returns:
+//     the number of characters written, *buffer* is not terminated.
+ReflectExport(reflect) unsigned FormatSigned(char *buffer, long value);
+
+// Function: FormatHex
+// Writes *value* in hexadecimal, e.g., 32u -> "0x20".
+//
+// Returns:
+//     the number of characters written, *buffer* is not terminated.
+ReflectExport(reflect) unsigned FormatHex(char *buffer, unsigned long value);
+
+// Function: FormatDouble
+// Writes the shortest decimal which parses back to *value*,
+// e.g., 0.1 -> "0.1", 3 -> "3", 1e100 -> "1e+100".
+//
+// Returns:
+//     the number of characters written, *buffer* is not terminated.
+ReflectExport(reflect) unsigned FormatDouble(char *buffer, double value);
+
+// Function: ParseSigned
+// Parses all *size* characters of *text* as strtol(text, &end, 0) would.
+//
+// Returns:
+//     false if *text* is not entirely a number.
+ReflectExport(reflect) bool ParseSigned(const char *text, unsigned size, long &value);
+
+// Function: ParseUnsigned
+// Parses all *size* characters of *text* as strtoul(text, &end, 0) would.
+//
+// Returns:
+//     false if *text* is not entirely a number.
+ReflectExport(reflect) bool ParseUnsigned(const char *text, unsigned size, unsigned long &value);
+
+// Function: ParseDouble
+// Parses all *size* characters of *text* as strtod would,
+// correctly rounded.
+//
+// Returns:
+//     false if *text* is not entirely a number.
+ReflectExport(reflect) bool ParseDouble(const char *text, unsigned size, double &value);
+
+} }
+
+#endif
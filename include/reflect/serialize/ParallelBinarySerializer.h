@@ -0,0 +1,74 @@
+#ifndef REFLECT_SERIALIZE_PARALLELBINARYSERIALIZER_H_
+#define REFLECT_SERIALIZE_PARALLELBINARYSERIALIZER_H_
+
+#include <reflect/config/config.h>
+#include <vector>
+
+namespace reflect {
+class OutputStream;
+class Dynamic;
+}
+
+namespace reflect { namespace serialize {
+
+// Class: ParallelBinarySerializer
+//     Writes several root objects in the <BinarySerializer> format,
+// serializing each root on a worker thread.
+//
+// Every root is written to a buffer of its own with its own reference
+// table.  <Run> then joins the buffers in the order the roots were added,
+// renumbering <BinaryReference>s and <BinaryBackReference>s so objects
+// shared between roots are written once, and the output is read by a
+// <BinaryDeserializer> as if each root had been serialized in turn:
+// (code)
+// ParallelBinarySerializer serializer(stream);
+// for(each level)
+//     serializer.Add(level);
+// serializer.Run();
+// ...
+// BinaryDeserializer deserializer(input);
+// for(each level)
+//     deserializer.Deserialize(level);
+// (end)
+//
+// The roots must not change while <Run> serializes them.  A root
+// shared with an earlier one is written as a back reference.
+// Workers read the classes' serialization plans without locking,
+// so types must not be loaded, unloaded or have members registered
+// during <Run> (see <Type.CompileLookups>).
+//
+// See Also:
+//     - <BinarySerializer>
+class ReflectExport(reflect) ParallelBinarySerializer
+{
+public:
+	// Constructor: ParallelBinarySerializer
+	//   Writes to *stream* on up to *threads* workers,
+	// 0 for <utility::Thread::HardwareConcurrency>.
+	ParallelBinarySerializer(OutputStream &stream, unsigned threads = 0);
+
+	// Function: Add
+	//   Queues *root* to be written by the next <Run>.
+	void Add(const Dynamic *root);
+
+	// Function: Run
+	//   Serializes the queued roots, writes them to the stream,
+	// and empties the queue.
+	//
+	// Returns:
+	//   false if a root failed to serialize or the stream failed,
+	// the stream is then incomplete.
+	bool Run();
+
+private:
+	ParallelBinarySerializer(const ParallelBinarySerializer &);
+	void operator =(const ParallelBinarySerializer &);
+
+	OutputStream &mStream;
+	unsigned mThreads;
+	std::vector<const Dynamic *> mRoots;
+};
+
+} }
+
+#endif
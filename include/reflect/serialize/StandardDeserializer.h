@@ -2,14 +2,13 @@
 #define REFLECT_SERIALIZE_STANDARDDESERIALIZER_H_
 
 #include <reflect/Deserializer.h>
+#include <reflect/BufferedInputStream.h>
+#include <reflect/serialize/ClassCache.h>
+#include <reflect/string/StringBlock.h>
 #include <vector>
 
 #include <reflect/config/config.h>
 
-namespace reflect {
-class InputStream;
-}
-
 namespace reflect { namespace string {
 class MutableString; 
 } }
@@ -19,14 +18,24 @@ namespace reflect { namespace serialize {
 // Class: StandardDeserializer
 //     A basic ascii text deserializer.
 //
+// Streams written with a name table (see <StandardSerializer>) are
+// recognized without being asked for.
+//
 // See Also:
 //     - <Deserializer>
 //     - <StandardSerializer>
 class ReflectExport(reflect) StandardDeserializer : public Deserializer
 {
 public:
+	// Constructor: StandardDeserializer(InputStream &)
+	// Reads the stream a byte at a time, never past the end of what it
+	// deserializes (but for a byte peeked at), so the rest can be read by others.
     StandardDeserializer(InputStream &);
 
+	// Constructor: StandardDeserializer(BufferedInputStream &)
+	// Tokenizes directly out of the stream's window, without buffering it again.
+	StandardDeserializer(BufferedInputStream &);
+
 protected:
     /*virtual*/ bool Begin(SerializationTag &, SerializationTag::TagType = SerializationTag::UnknownTag);
     /*virtual*/ bool End(SerializationTag &);
@@ -38,20 +47,24 @@ protected:
     /*virtual*/ bool Deserialize(Dynamic *&object);
     /*virtual*/ bool Reference(Dynamic *object);
     /*virtual*/ bool DeserializeTextChunk(char *text, unsigned &max_bytes, bool &complete);
+    /*virtual*/ bool DeserializeTextView(string::Fragment &text);
     /*virtual*/ bool DeserializeData(void *data, unsigned nbytes);
 	/*virtual*/ bool DeserializeEnum(int &value, const EnumType *clazz);
 	/*virtual*/ bool DeserializeProperty(void *object, const Property *prop);
 
 private:
 	std::vector<Dynamic *> mReferenced;
-	InputStream &mStream;
-	char mPeekChar;
+	BufferedInputStream mBuffer;
+	BufferedInputStream &mInput;
 	char mDeserializingText;
+	string::StringBlock mNames;
+	ClassCache mClasses;
 
 	char Peek();
 	char Read();
 	void EatSpace();
 	int ReadWord(string::MutableString);
+	int ReadName(string::MutableString);
 	SerializationTag *mCurrentTag;
 };
 
@@ -3,8 +3,9 @@
 
 #include <reflect/Serializer.h>
 #include <reflect/string/String.h>
+#include <reflect/string/StringBlock.h>
 #include <reflect/config/config.h>
-#include <map>
+#include <reflect/utility/PointerMap.hpp>
 
 namespace reflect {
 class OutputStream;
@@ -15,13 +16,20 @@ namespace reflect { namespace serialize {
 // Class: StandardSerializer
 //     A basic ascii text serializer.
 //
+// With a name table, property and class names are written in full only
+// the first time, as "+name", which adds them to a <string::StringBlock>
+// kept by both ends of the stream.  Later uses write "*offset", the name's
+// offset in the block.
+//
 // See Also:
 //     - <Serializer>
 //     - <StandardDeserializer>
 class ReflectExport(reflect) StandardSerializer : public Serializer
 {
 public:
-    StandardSerializer(OutputStream &stream);
+    // Constructor: StandardSerializer
+    //   Writes to *stream*, with a name table if *name_table* is set.
+    StandardSerializer(OutputStream &stream, bool name_table = false);
     
 protected:
 	// Function: Begin
@@ -29,7 +37,7 @@ protected:
 	//
 	// Tags are written in the following formats:
 	//   OBJECT    - "(<<type>> ... )"
-	//   PROPERTY  - "$<<name>>= ... ;"
+	//   PROPERTY  - "$<<name>>= ... ;" (see <WriteName>)
 	//   ATTRIBUTE - "[<<name>>= ... ]"
 	//   ITEM      - "{ ... }"
     bool Begin(const SerializationTag &); /*virtual*/
@@ -43,15 +51,16 @@ protected:
     bool Serialize(bool); /*virtual*/
     
     // Function: Serialize(long)
-	//   Writes "%ld", e.g., 3 -> "3"
+	//   Writes "%ld", e.g., 3 -> "3", see <FormatSigned>.
     bool Serialize(long); /*virtual*/
 
     // Function: Serialize(unsigned long)
-	//   Writes "0x%lX", e.g., 32u -> "0x20"
+	//   Writes "0x%lX", e.g., 32u -> "0x20", see <FormatHex>.
     bool Serialize(unsigned long); /*virtual*/
     
     // Function: Serialize(double)
-    //   Writes "%#g".  e.g., 3 -> "3.0" 
+    //   Writes the shortest text which reads back exactly,
+    // e.g., 3 -> "3", 0.1 -> "0.1", see <FormatDouble>.
     bool Serialize(double); /*virtual*/
     
     // Function: Serialize(const Dynamic *obj)
@@ -73,6 +82,10 @@ protected:
     //   Writes "@<<count>>" where *count* is the number of 
     // references made so far.
     bool Reference(const Dynamic *object); /*virtual*/
+
+    // Function: Reserve
+    //   Sizes the reference table for *objects* referenced objects.
+    void Reserve(unsigned objects); /*virtual*/
     
     // Function: SerializeText
     //    Writes *nbytes* of *text* as a string with
@@ -93,8 +106,18 @@ protected:
     // TODO: Figure out how/if this can prevent slicing when using CompositeSerializers.
    	bool SerializeProperty(const void *object, const Property *prop); /*virtual*/
 
+    // Function: SerializeArray
+    //    Writes the numbers exactly as <Serialize> would, but formats
+    // them into a local buffer and writes it a few kilobytes at a time.
+    bool SerializeArray(const Type *type, const void *data, unsigned count); /*virtual*/
+
 protected:
     bool Write(const char *string, ...);
+    bool WriteText(const char *text, unsigned nbytes);
+
+    // Function: WriteName
+    //   Writes *prefix* and then *name*, or its name table entry.
+    bool WriteName(const char *prefix, const char *name);
     void Indent();
     void Undent();
     void Break();
@@ -106,9 +129,11 @@ private:
     bool mBreak;
 	bool mSpace;
 	int mNextIndex;
-	std::map<const Dynamic *, int> mReferenced;
+	utility::PointerMap<int> mReferenced;
 	OutputStream &mStream;
 	string::String mBuffer;
+	bool mNameTable;
+	string::StringBlock mNames;
 };
 
 } }
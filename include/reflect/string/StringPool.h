@@ -4,37 +4,54 @@
 #include <reflect/string/SharedString.h>
 #include <reflect/utility/Context.h>
 #include <reflect/config/config.h>
-#include <vector>
 
 namespace reflect { namespace string {
 
 // Class: StringPool
 // 
 // A string pool manages <SharedStrings>.
+//
+// Strings are kept in a hash set, each entry storing its hash and
+// length so a probe rarely touches the characters, split into shards
+// by hash with a lock each, so threads may intern and find strings
+// concurrently.  Copied strings are packed into chunks owned by the
+// pool, their addresses never change and they live as long as the pool.
 class ReflectExport(reflect) StringPool
 {
 public:
 	// Constructor: StringPool
 	explicit StringPool(const StringPool *parent = NULL);
 
+	~StringPool();
+
 	// Function: Copy
 	SharedString Copy(const Fragment &);
 
 	// Function: Literal
+	// Interns the string without copying it, it must outlive the pool.
 	SharedString Literal(const ConstString &);
 
 	// Function: Find
 	SharedString Find(const Fragment &) const;
 
+	// Function: Hash
+	// The hash the pool files *string* under.
+	static unsigned Hash(const Fragment &string);
+
 protected:
 	const StringPool *mParent;
 
 private:
-	const char *FindRecursive(const Fragment &) const;
-	const char *FindFirst(const Fragment &, std::vector<const char *>::iterator &);
-	std::vector<const char *>::size_type BinarySearch(const Fragment &, bool &) const;
-	
-	std::vector<const char *> mStringPool;
+	StringPool(const StringPool &);
+	void operator =(const StringPool &);
+
+	class Shard;
+
+	Shard &ShardOf(unsigned hash) const;
+	const char *FindRecursive(const Fragment &, unsigned hash) const;
+	const char *Intern(const Fragment &, const char *literal);
+
+	Shard *mShards;
 };
 
 // Class: StringPoolContext
@@ -44,6 +61,10 @@ class ReflectExport(reflect) StringPoolContext
 {
 public:
 	StringPoolContext();
+
+	// Constructor: StringPoolContext(GlobalTag)
+	// The process wide pool, see <utility::Context.Global>.
+	explicit StringPoolContext(GlobalTag);
 };
 
 } }
@@ -1,13 +1,20 @@
 #ifndef REFLECT_UTILITY_CONTEXT_H_
 #define REFLECT_UTILITY_CONTEXT_H_
 
+#include <reflect/config/config.h>
+
 namespace reflect { namespace utility {
 
 // Class: Context<Type>
 // A template base class which allows global access to its Type's current instance.
 //
-// Contexts are a lightweight and powerful (if thread unsafe) way of
-// passing data across the callstack.
+// Contexts are a lightweight and powerful way of passing data across the callstack.
+//
+// Each thread has its own stack of contexts (see <REFLECT_THREAD_LOCAL>).
+// A context constructed with <Global>, a static instance, is the process
+// wide context, current on every thread which has not constructed one
+// of its own.  A worker thread can run in another thread's context
+// with <Inherit>.
 //
 // Note: Contexts are only used in Reflect to provide access to the global
 // <StringPool> used by <SharedStrings>.
@@ -17,12 +24,40 @@ class Context
 public:
 	// Function: GetContext
 	// Returns:
-	//    The current (most recently constructed) active context.
+	//    The current (most recently constructed) active context on this thread.
 	static Type *GetContext();
 
+	// Constant: Global
+	// Tags the constructor of the process wide context.
+	enum GlobalTag { Global };
+
+	// Class: Inherit
+	// Makes a context, usually one of another thread, current on this
+	// thread while the Inherit lives.  Contexts constructed meanwhile
+	// stack on top of it, and must be destroyed first.
+	//
+	// The inherited context must outlive the Inherit.
+	class Inherit
+	{
+	public:
+		explicit Inherit(Type *context);
+		~Inherit();
+
+	private:
+		Inherit(const Inherit &);
+		const Inherit &operator =(const Inherit &);
+
+		Type *mPrevious;
+	};
+
 protected:
 	Context();
 
+	// Constructor: Context(GlobalTag)
+	// Makes this the process wide context, for a static instance
+	// constructed before any thread but the main one is started.
+	explicit Context(GlobalTag);
+
 	// Function: PreviousContext
 	// The context that was active when the current context was constructed.
 	// Some contexts do not want to expose this method, so it is a protected method,
@@ -33,7 +68,8 @@ public:
 	~Context();
 
 private:
-	static Type *sContext;
+	static REFLECT_THREAD_LOCAL Type *sContext;
+	static Type *sGlobalContext;
 	Type *sLink;
 
 	// The following stubs disable copying of contexts.
@@ -5,7 +5,7 @@ namespace reflect { namespace utility {
 template<typename Type>
 Type *Context<Type>::GetContext()
 {
-	return sContext;
+	return sContext ? sContext : sGlobalContext;
 }
 
 template<typename Type>
@@ -15,19 +15,48 @@ Context<Type>::Context()
 	sContext = static_cast<Type *>(this);
 }
 
+template<typename Type>
+Context<Type>::Context(GlobalTag)
+	: sLink(0)
+{
+	sGlobalContext = static_cast<Type *>(this);
+}
+
 template<typename Type>
 Type *Context<Type>::PreviousContext() const
 {
-	return sLink;
+	if(sLink || sGlobalContext == static_cast<const Type *>(this))
+		return sLink;
+
+	return sGlobalContext;
 }
 
 template<typename Type>
 Context<Type>::~Context()
 {
-	sContext = sLink;
+	if(sGlobalContext == static_cast<Type *>(this))
+		sGlobalContext = 0;
+	else
+		sContext = sLink;
 }
 
 template<typename Type>
-Type *Context<Type>::sContext = 0;
+Context<Type>::Inherit::Inherit(Type *context)
+	: mPrevious(sContext)
+{
+	sContext = context;
+}
+
+template<typename Type>
+Context<Type>::Inherit::~Inherit()
+{
+	sContext = mPrevious;
+}
+
+template<typename Type>
+REFLECT_THREAD_LOCAL Type *Context<Type>::sContext = 0;
+
+template<typename Type>
+Type *Context<Type>::sGlobalContext = 0;
 
 } }
@@ -0,0 +1,25 @@
+#ifndef REFLECT_UTILITY_HASHBYTES_H_
+#define REFLECT_UTILITY_HASHBYTES_H_
+
+#include <cstddef>
+
+namespace reflect { namespace utility {
+
+// Function: HashBytes
+// The 32-bit FNV-1a hash of *size* bytes at *data*.
+inline unsigned HashBytes(const char *data, std::size_t size)
+{
+	unsigned hash = 2166136261u;
+
+	for(std::size_t index = 0; index < size; ++index)
+	{
+		hash ^= static_cast<unsigned char>(data[index]);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+} }
+
+#endif
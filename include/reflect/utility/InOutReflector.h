@@ -7,6 +7,8 @@
 #include <reflect/Reflector.h>
 #include <reflect/serialize/StandardSerializer.h>
 #include <reflect/serialize/StandardDeserializer.h>
+#include <reflect/serialize/BinarySerializer.h>
+#include <reflect/serialize/BinaryDeserializer.h>
 #include <reflect/serialize/ShallowSerializer.h>
 #include <reflect/serialize/ShallowDeserializer.h>
 
@@ -93,7 +95,8 @@ private:
 			}
 
 			std::memcpy(data, mString.data(), size);
-			mString = mString.substr(size);
+			// String::substr stops at the first NUL, binary streams may contain them.
+			mString = string::Fragment(mString.c_str(), mString.size()).substr(size);
 			return size;
 		}
 	private:
@@ -169,6 +172,10 @@ typedef InOutReflector<
 	ComposedShallowDeserializer<serialize::StandardDeserializer> >
 	ShallowInOutReflector;
 
+typedef InOutReflector<
+	serialize::BinarySerializer,
+	serialize::BinaryDeserializer> BinaryInOutReflector;
+
 } }
 
 #endif
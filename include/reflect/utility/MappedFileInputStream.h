@@ -0,0 +1,41 @@
+#ifndef REFLECT_UTILITY_MAPPEDFILEINPUTSTREAM_H_
+#define REFLECT_UTILITY_MAPPEDFILEINPUTSTREAM_H_
+
+#include <reflect/BufferedInputStream.h>
+#include <reflect/string/ConstString.h>
+#include <reflect/config/config.h>
+
+namespace reflect { namespace utility {
+
+// Class: MappedFileInputStream
+//
+// A <BufferedInputStream> whose window is the whole file, mapped
+// read-only into memory and advised for sequential access.
+// Deserializers parse straight out of the page cache, and the stream
+// is <BufferedInputStream.Resident>.
+class ReflectExport(reflect) MappedFileInputStream : public BufferedInputStream
+{
+public:
+	// Constructor: MappedFileInputStream
+	// Maps *filename*, check <IsOpen> for success.
+	MappedFileInputStream(string::ConstString filename);
+
+	~MappedFileInputStream();
+
+	// Function: IsOpen
+	// True when the file was mapped (an empty file is open, with nothing to read).
+	bool IsOpen() const { return mOpen; }
+
+private:
+	void *mMapping;
+	size_type mSize;
+	bool mOpen;
+#if defined(_WIN32)
+	void *mFileHandle;
+	void *mMappingHandle;
+#endif
+};
+
+} }
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef REFLECT_UTILITY_MUTEX_H_
+#define REFLECT_UTILITY_MUTEX_H_
+
+#include <reflect/config/config.h>
+
+namespace reflect { namespace utility {
+
+// Class: Mutex
+// A non-recursive lock, a pthread mutex or a windows critical section.
+class ReflectExport(reflect) Mutex
+{
+public:
+	Mutex();
+	~Mutex();
+
+	// Function: Lock
+	void Lock();
+
+	// Function: Unlock
+	void Unlock();
+
+private:
+	Mutex(const Mutex &);
+	void operator =(const Mutex &);
+
+	void *mHandle;
+};
+
+// Class: ScopedLock
+// Holds a <Mutex> for the lifetime of the lock.
+class ScopedLock
+{
+public:
+	explicit ScopedLock(Mutex &mutex)
+		: mMutex(mutex)
+	{
+		mMutex.Lock();
+	}
+
+	~ScopedLock()
+	{
+		mMutex.Unlock();
+	}
+
+private:
+	ScopedLock(const ScopedLock &);
+	void operator =(const ScopedLock &);
+
+	Mutex &mMutex;
+};
+
+} }
+
+#endif
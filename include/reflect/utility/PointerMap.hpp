@@ -0,0 +1,219 @@
+#ifndef REFLECT_UTILITY_POINTERMAP_HPP_
+#define REFLECT_UTILITY_POINTERMAP_HPP_
+
+#include <cstddef>
+
+namespace reflect { namespace utility {
+
+// Class: PointerMap
+//
+// An open addressing hash table from (non-null) pointers to values,
+// for the serializers' reference tables and the script bindings'
+// object identity tables.
+//
+// Entries live in one power of two sized array probed linearly,
+// so a lookup usually touches a single cache line.  <Remove> shifts
+// the rest of the probe sequence back over the removed entry rather
+// than leaving a marker, so tables with many insertions and removals
+// don't slow down.  <Clear> empties the table but keeps its memory
+// for the next use.
+//
+// Inserting or removing entries moves others, pointers returned by
+// <Find> are only valid until the table is next changed.
+template<typename Value>
+class PointerMap
+{
+public:
+	PointerMap()
+		: mEntries(0)
+		, mCapacity(0)
+		, mSize(0)
+	{
+	}
+
+	~PointerMap()
+	{
+		delete [] mEntries;
+	}
+
+	// Function: Size
+	// The number of entries.
+	std::size_t Size() const { return mSize; }
+
+	// Function: Find
+	// The value stored for *key*, or NULL.
+	Value *Find(const void *key) const
+	{
+		if(0 == mSize)
+			return 0;
+
+		for(std::size_t index = Hash(key); ; index = (index + 1) & (mCapacity - 1))
+		{
+			Entry &entry = mEntries[index];
+
+			if(entry.key == key)
+				return &entry.value;
+
+			if(entry.key == 0)
+				return 0;
+		}
+	}
+
+	// Function: Insert
+	// Stores *value* for *key* unless the key is already present.
+	//
+	// Returns:
+	//     true if the entry was added.
+	bool Insert(const void *key, const Value &value)
+	{
+		bool inserted = false;
+		Value &stored = Probe(key, inserted);
+
+		if(inserted)
+			stored = value;
+
+		return inserted;
+	}
+
+	// Function: FindOrInsert
+	// The value stored for *key*, stores *value* first if the key is not present.
+	Value &FindOrInsert(const void *key, const Value &value = Value())
+	{
+		bool inserted = false;
+		Value &stored = Probe(key, inserted);
+
+		if(inserted)
+			stored = value;
+
+		return stored;
+	}
+
+	// Function: Remove
+	// Removes the entry for *key*.
+	//
+	// Returns:
+	//     false if the key was not present.
+	bool Remove(const void *key)
+	{
+		if(0 == mSize)
+			return false;
+
+		const std::size_t mask = mCapacity - 1;
+		std::size_t hole = Hash(key);
+
+		for(; mEntries[hole].key != key; hole = (hole + 1) & mask)
+		{
+			if(mEntries[hole].key == 0)
+				return false;
+		}
+
+		// move back entries which would no longer be found past the hole.
+		for(std::size_t index = (hole + 1) & mask; mEntries[index].key; index = (index + 1) & mask)
+		{
+			std::size_t home = Hash(mEntries[index].key);
+
+			if(((index - home) & mask) >= ((index - hole) & mask))
+			{
+				mEntries[hole] = mEntries[index];
+				hole = index;
+			}
+		}
+
+		mEntries[hole] = Entry();
+		mSize--;
+		return true;
+	}
+
+	// Function: Reserve
+	// Makes room for *count* entries without rehashing.
+	void Reserve(std::size_t count)
+	{
+		std::size_t capacity = mCapacity ? mCapacity : std::size_t(MinimumCapacity);
+
+		while(capacity < 2 * count)
+			capacity *= 2;
+
+		if(capacity > mCapacity)
+			Rehash(capacity);
+	}
+
+	// Function: Clear
+	// Removes all entries, keeping the memory.
+	void Clear()
+	{
+		for(std::size_t index = 0; index < mCapacity; ++index)
+			mEntries[index] = Entry();
+
+		mSize = 0;
+	}
+
+private:
+	PointerMap(const PointerMap &);
+	void operator =(const PointerMap &);
+
+	enum { MinimumCapacity = 16 };
+
+	struct Entry
+	{
+		Entry() : key(0), value() {}
+
+		const void *key;
+		Value value;
+	};
+
+	Value &Probe(const void *key, bool &inserted)
+	{
+		if(2 * (mSize + 1) > mCapacity)
+			Rehash(mCapacity ? mCapacity * 2 : std::size_t(MinimumCapacity));
+
+		for(std::size_t index = Hash(key); ; index = (index + 1) & (mCapacity - 1))
+		{
+			Entry &entry = mEntries[index];
+
+			if(entry.key == key)
+				return entry.value;
+
+			if(entry.key == 0)
+			{
+				entry.key = key;
+				mSize++;
+				inserted = true;
+				return entry.value;
+			}
+		}
+	}
+
+	std::size_t Hash(const void *key) const
+	{
+		// fibonacci hashing, the low bits of a pointer are mostly alignment.
+		std::size_t bits = reinterpret_cast<std::size_t>(key);
+		bits ^= bits >> 16;
+		return (bits * std::size_t(2654435769u)) >> 4 & (mCapacity - 1);
+	}
+
+	void Rehash(std::size_t capacity)
+	{
+		Entry *entries = mEntries;
+		std::size_t old_capacity = mCapacity;
+
+		mEntries = new Entry[capacity];
+		mCapacity = capacity;
+		mSize = 0;
+
+		for(std::size_t index = 0; index < old_capacity; ++index)
+		{
+			if(entries[index].key)
+				Insert(entries[index].key, entries[index].value);
+		}
+
+		delete [] entries;
+	}
+
+	Entry *mEntries;
+	std::size_t mCapacity;
+	std::size_t mSize;
+};
+
+} }
+
+#endif
@@ -5,8 +5,12 @@
 
 #include <reflect/serialize/StandardSerializer.h>
 #include <reflect/serialize/StandardDeserializer.h>
+#include <reflect/serialize/BinarySerializer.h>
+#include <reflect/serialize/BinaryDeserializer.h>
 #include <reflect/Reflector.h>
 #include <reflect/InputStream.h>
+#include <reflect/BufferedInputStream.h>
+#include <reflect/utility/MappedFileInputStream.h>
 #include <reflect/OutputStream.h>
 #include <reflect/string/String.h>
 
@@ -57,9 +61,9 @@ public:
 
 // Section: Save/Load Functions
 
-// Function: SaveFile
+// Function: SaveFileWith
 //
-// Saves "data" into a file using a StandardSerializer.
+// Saves "data" into a file using a SerializerType constructed on the file.
 //
 // Parameters:
 //    data - any kind of reflectable data.
@@ -67,13 +71,13 @@ public:
 //
 // Returns:
 //   true - when serialization succeeded.
-template<typename Type>
-bool SaveFile(const Type &data, string::ConstString filename)
+template<typename SerializerType, typename Type>
+bool SaveFileWith(const Type &data, string::ConstString filename)
 {
 	if(std::FILE *file = std::fopen(filename.c_str(), "wb"))
 	{
 		FileOutputStream output(file);
-		serialize::StandardSerializer serializer(output);
+		SerializerType serializer(output);
 		Reflector reflector(serializer);
 
 		reflector | data;
@@ -88,9 +92,9 @@ bool SaveFile(const Type &data, string::ConstString filename)
 	}
 }
 
-// Function: LoadFile
+// Function: LoadFileWith
 //
-// Saves "data" into a file using a StandardDeserializer.
+// Loads "data" from a file using a DeserializerType constructed on the file.
 //
 // Parameters:
 //    data - any kind of reflectable data.
@@ -98,13 +102,14 @@ bool SaveFile(const Type &data, string::ConstString filename)
 //
 // Returns:
 //    true - when deserialization succeeded.
-template<typename Type>
-bool LoadFile(Type &data, string::ConstString filename)
+template<typename DeserializerType, typename Type>
+bool LoadFileWith(Type &data, string::ConstString filename)
 {
 	if(std::FILE *file = std::fopen(filename.c_str(), "rb"))
 	{
-		FileInputStream output(file);
-		serialize::StandardDeserializer deserializer(output);
+		FileInputStream file_input(file);
+		BufferedInputStream input(file_input, 1 << 16);
+		DeserializerType deserializer(input);
 		Reflector reflector(deserializer);
 
 		reflector | data;
@@ -119,6 +124,106 @@ bool LoadFile(Type &data, string::ConstString filename)
 	}
 }
 
+// Function: LoadMappedFileWith
+//
+// Loads "data" from a file the caller has mapped into memory,
+// using a DeserializerType constructed on the mapping.
+//
+// Members loaded as views (see <DirectFragmentViewProperty>) point
+// into the mapping, so "input" must outlive "data".
+//
+// Parameters:
+//    data - any kind of reflectable data.
+//    input - the mapped file to load from.
+//
+// Returns:
+//    true - when deserialization succeeded.
+template<typename DeserializerType, typename Type>
+bool LoadMappedFileWith(Type &data, MappedFileInputStream &input)
+{
+	if(input.IsOpen())
+	{
+		DeserializerType deserializer(input);
+		Reflector reflector(deserializer);
+
+		reflector | data;
+
+		return reflector.Ok();
+	}
+	else
+	{
+		return false;
+	}
+}
+
+// Function: SaveFile
+//
+// Saves "data" into a file using a StandardSerializer.
+//
+// Parameters:
+//    data - any kind of reflectable data.
+//    filename - the name of the file to save to.
+//
+// Returns:
+//   true - when serialization succeeded.
+template<typename Type>
+bool SaveFile(const Type &data, string::ConstString filename)
+{
+	return SaveFileWith<serialize::StandardSerializer>(data, filename);
+}
+
+// Function: LoadFile
+//
+// Loads "data" from a file using a StandardDeserializer.
+//
+// Parameters:
+//    data - any kind of reflectable data.
+//    filename - the name of the file to load from.
+//
+// Returns:
+//    true - when deserialization succeeded.
+template<typename Type>
+bool LoadFile(Type &data, string::ConstString filename)
+{
+	return LoadFileWith<serialize::StandardDeserializer>(data, filename);
+}
+
+// Function: LoadMappedFile
+//
+// Loads "data" from a memory mapped file using a StandardDeserializer.
+template<typename Type>
+bool LoadMappedFile(Type &data, MappedFileInputStream &input)
+{
+	return LoadMappedFileWith<serialize::StandardDeserializer>(data, input);
+}
+
+// Function: SaveBinaryFile
+//
+// Saves "data" into a file using a BinarySerializer.
+template<typename Type>
+bool SaveBinaryFile(const Type &data, string::ConstString filename)
+{
+	return SaveFileWith<serialize::BinarySerializer>(data, filename);
+}
+
+// Function: LoadBinaryFile
+//
+// Loads "data" from a file written by <SaveBinaryFile>.
+template<typename Type>
+bool LoadBinaryFile(Type &data, string::ConstString filename)
+{
+	return LoadFileWith<serialize::BinaryDeserializer>(data, filename);
+}
+
+// Function: LoadMappedBinaryFile
+//
+// Loads "data" from a memory mapped file written by <SaveBinaryFile>.
+template<typename Type>
+bool LoadMappedBinaryFile(Type &data, MappedFileInputStream &input)
+{
+	return LoadMappedFileWith<serialize::BinaryDeserializer>(data, input);
+}
+
 } }
 
 
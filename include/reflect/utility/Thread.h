@@ -0,0 +1,48 @@
+#ifndef REFLECT_UTILITY_THREAD_H_
+#define REFLECT_UTILITY_THREAD_H_
+
+#include <reflect/config/config.h>
+
+namespace reflect { namespace utility {
+
+// Class: Thread
+// A worker thread running one function, a pthread or a windows thread.
+//
+// Contexts are per thread, a worker which should see its creator's
+// contexts must <Context.Inherit> them, see <utility::Context>.
+class ReflectExport(reflect) Thread
+{
+public:
+	typedef void (*Function)(void *argument);
+
+	Thread();
+
+	// Destructor: ~Thread
+	// Waits for the thread to finish, see <Join>.
+	~Thread();
+
+	// Function: Start
+	// Runs *function* with *argument* on a new thread.
+	//
+	// Returns:
+	//     false if the thread could not be created, or is already running.
+	bool Start(Function function, void *argument);
+
+	// Function: Join
+	// Waits for the thread to finish, if it was started.
+	void Join();
+
+	// Function: HardwareConcurrency
+	// The number of threads the machine can run at once, at least 1.
+	static unsigned HardwareConcurrency();
+
+private:
+	Thread(const Thread &);
+	void operator =(const Thread &);
+
+	void *mHandle;
+};
+
+} }
+
+#endif
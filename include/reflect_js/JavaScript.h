@@ -38,6 +38,40 @@ const Function *CreateFunction(const char *, FunctionType);
 
 namespace reflect { namespace js {
 
+// Struct: WrapperStatistics
+// Counts of the script objects a <JavaScriptRuntime> made for native objects,
+// since the runtime was created.
+struct WrapperStatistics
+{
+	WrapperStatistics()
+		: created(0)
+		, reused(0)
+		, released(0)
+		, destroyed(0)
+		, live(0)
+	{}
+
+	// Variable: created
+	// Script objects made to wrap a native object.
+	unsigned long created;
+
+	// Variable: reused
+	// Native objects passed to scripts which were already wrapped.
+	unsigned long reused;
+
+	// Variable: released
+	// Wrappers finalized by the garbage collector.
+	unsigned long released;
+
+	// Variable: destroyed
+	// Native objects destroyed by the runtime once nothing referenced them.
+	unsigned long destroyed;
+
+	// Variable: live
+	// Wrappers not yet finalized.
+	unsigned long live;
+};
+
 // Class: JavaScriptRuntime
 // Wraps a JSRuntime, a JSRuntime object represents
 // a single JavaScript object space which can hold
@@ -62,6 +96,11 @@ public:
 	// Function: GetRuntime
 	JSRuntime *GetRuntime() const { return mRuntime; }
 
+	// Function: GetWrapperStatistics
+	// How often native objects were wrapped, to see how much
+	// wrappers churn as scripts walk object graphs.
+	WrapperStatistics GetWrapperStatistics() const;
+
 private:
 	JavaScriptRuntime(JSRuntime *);
 	static JavaScriptRuntime sSharedRuntime;
@@ -3,7 +3,13 @@
 
 #include <reflect_js/JavaScript.h>
 #include <reflect/utility/Context.h>
+#include <reflect/utility/PointerMap.hpp>
+#include <reflect/string/SharedString.h>
+#include <reflect/string/String.h>
+#include <reflect/PropertyAccessor.h>
+#include <reflect/PersistentClass.h>
 #include <jsapi.h>
+#include <vector>
 
 namespace reflect { namespace function { class Function; } }
 
@@ -27,6 +33,52 @@ JSBool EnumerateRootNamespaces(JSContext *cx, JSObject *obj);
 
 const Type *GetNativeType(JSContext *cx, JSObject *obj);
 
+// Class: PropertyCache
+//
+// The properties and functions of one class which scripts have used,
+// looked up once per name.  Each name gets a slot, which is the tinyid
+// of the properties defined on the class' script objects, so their
+// getters and setters find the resolved property without the name.
+//
+// Slots are looked up again by name when types are loaded or unloaded.
+class PropertyCache
+{
+public:
+	// Constant: MaxSlots
+	// tinyids are 8 bit, names past these are not cached.
+	enum { MaxSlots = 128 };
+
+	struct Entry
+	{
+		Entry();
+
+		string::SharedString name;
+		const Property *property;
+		const DataProperty *data;
+		PropertyAccessor<int> ints;
+		PropertyAccessor<string::String> strings;
+		const function::Function *function;
+	};
+
+	PropertyCache(const PersistentClass *clazz);
+
+	// Function: Slot
+	// The slot for *name*, or -1 when all the slots are in use.
+	int Slot(const char *name);
+
+	// Function: Find
+	// The entry in *slot*, or NULL.
+	const Entry *Find(int slot);
+
+private:
+	void Resolve(Entry &entry) const;
+
+	const PersistentClass *mClass;
+	unsigned mGeneration;
+	std::vector<Entry> mEntries;
+	utility::PointerMap<int> mSlots;
+};
+
 class RuntimeData
 {
 public:
@@ -46,6 +98,13 @@ public:
 	
 	void MakeNativeObject(JSContext *cx);
 
+	// Function: Properties
+	// The <PropertyCache> of *clazz*.
+	PropertyCache &Properties(const PersistentClass *clazz);
+
+	// Function: Statistics
+	const WrapperStatistics &Statistics() const { return mStatistics; }
+
 	~RuntimeData();	
 
 private:
@@ -63,9 +122,9 @@ private:
 		JavaInfo(JSObject *obj = 0);
 	};
 
-	typedef std::map<const Type *, JSObject *> NativePrototypeMap;
-	typedef std::map<void *, JavaInfo> NativeToJavaMap;
-	typedef std::map<JSObject *, NativeInfo> JavaToNativeMap;
+	typedef utility::PointerMap<JSObject *> NativePrototypeMap;
+	typedef utility::PointerMap<JavaInfo> NativeToJavaMap;
+	typedef utility::PointerMap<NativeInfo> JavaToNativeMap;
 
 	JSRuntime *mRuntime;
 	JSObject *mNative;
@@ -73,6 +132,10 @@ private:
 	NativeToJavaMap mOpaqueToObject;
 	JavaToNativeMap mObjectToOpaque;
 	NativePrototypeMap mTypePrototypes;
+	WrapperStatistics mStatistics;
+
+	utility::PointerMap<PropertyCache *> mPropertyCaches;
+	std::vector<PropertyCache *> mPropertyCacheList;
 };
 
 RuntimeData *GetRuntimeData(JSRuntime *rt);
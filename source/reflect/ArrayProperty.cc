@@ -4,6 +4,7 @@
 #include <reflect/Deserializer.h>
 #include <reflect/SerializationTag.h>
 #include <reflect/PrimitiveTypes.h>
+#include <reflect/serialize/ArrayElement.h>
 #include <reflect/Class.hpp>
 
 DEFINE_REFLECTION(reflect::ArrayProperty, "reflect::ArrayProperty")
@@ -13,6 +14,11 @@ namespace reflect {
 
 class Reflector;
 
+void *ArrayProperty::ItemData(const void *, void *) const
+{
+	return 0;
+}
+
 void ArrayProperty::Serialize(const void *in, void *out, Reflector &reflector) const
 {
 	if(reflector.Serializing())
@@ -31,7 +37,13 @@ void ArrayProperty::Serialize(const void *in, void *out, Reflector &reflector) c
 			}
 		}
 
-		for(unsigned index = 0; index < unsigned(size); ++index)
+		void *items = size ? ItemData(in, 0) : 0;
+
+		if(items && serialize::ArrayElementOf(ItemType()) != serialize::NoArrayElement)
+		{
+			reflector.Check(serializer.SerializeArray(ItemType(), items, unsigned(size)));
+		}
+		else for(unsigned index = 0; index < unsigned(size); ++index)
 		{
 			SerializeItem(in, out, index, reflector);
 		}
@@ -57,7 +69,13 @@ void ArrayProperty::Serialize(const void *in, void *out, Reflector &reflector) c
 
 		reflector.Check(Resize(out, size));
 
-		if(reflector) for(unsigned index = 0; index < size; ++index)
+		void *items = reflector && size ? ItemData(in, out) : 0;
+
+		if(items && serialize::ArrayElementOf(ItemType()) != serialize::NoArrayElement)
+		{
+			reflector.Check(deserializer.DeserializeArray(ItemType(), items, size));
+		}
+		else if(reflector) for(unsigned index = 0; index < size; ++index)
 		{
 			SerializeItem(in, out, index, reflector);
 		}
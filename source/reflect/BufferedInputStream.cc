@@ -0,0 +1,115 @@
+#include <reflect/BufferedInputStream.h>
+#include <cstring>
+
+namespace reflect {
+
+BufferedInputStream::BufferedInputStream()
+	: mSource(0)
+	, mBuffer(0)
+	, mCapacity(0)
+	, mReadAhead(false)
+	, mCursor(0)
+	, mEnd(0)
+{
+}
+
+BufferedInputStream::BufferedInputStream(InputStream &source, size_type capacity)
+	: mSource(&source)
+	, mBuffer(capacity > size_type(DefaultCapacity) ? new char[capacity] : mInlineBuffer)
+	, mCapacity(capacity > size_type(DefaultCapacity) ? capacity : size_type(DefaultCapacity))
+	, mReadAhead(capacity != size_type(NoReadAhead))
+	, mCursor(mBuffer)
+	, mEnd(mBuffer)
+{
+}
+
+BufferedInputStream::BufferedInputStream(const void *data, size_type size)
+	: mSource(0)
+	, mBuffer(0)
+	, mCapacity(0)
+	, mReadAhead(false)
+	, mCursor(static_cast<const char *>(data))
+	, mEnd(static_cast<const char *>(data) + size)
+{
+}
+
+BufferedInputStream::~BufferedInputStream()
+{
+	if(mBuffer != mInlineBuffer)
+		delete [] mBuffer;
+}
+
+void BufferedInputStream::SetMemory(const void *data, size_type size)
+{
+	mSource = 0;
+	mCursor = static_cast<const char *>(data);
+	mEnd = mCursor + size;
+}
+
+BufferedInputStream::size_type BufferedInputStream::Fill(size_type wanted)
+{
+	size_type available = Available();
+
+	if(available >= wanted || 0 == mSource)
+		return available;
+
+	if(wanted > mCapacity)
+	{
+		char *buffer = new char[wanted];
+		std::memcpy(buffer, mCursor, available);
+
+		if(mBuffer != mInlineBuffer)
+			delete [] mBuffer;
+
+		mBuffer = buffer;
+		mCapacity = wanted;
+	}
+	else if(mCursor != mBuffer)
+	{
+		std::memmove(mBuffer, mCursor, available);
+	}
+
+	mCursor = mBuffer;
+
+	size_type limit = mReadAhead ? mCapacity : wanted;
+
+	while(available < wanted)
+	{
+		size_type nread = mSource->Read(mBuffer + available, limit - available);
+
+		if(0 == nread)
+			break;
+
+		available += nread;
+	}
+
+	mEnd = mBuffer + available;
+
+	return available;
+}
+
+BufferedInputStream::size_type BufferedInputStream::Read(void *buffer, size_type bufmax)
+{
+	char *output = static_cast<char *>(buffer);
+	size_type size = Available() < bufmax ? Available() : bufmax;
+
+	if(size)
+	{
+		std::memcpy(output, mCursor, size);
+		Consume(size);
+	}
+
+	if(mSource) while(size < bufmax)
+	{
+		size_type nread = mSource->Read(output + size, bufmax - size);
+
+		if(0 == nread)
+			break;
+
+		size += nread;
+	}
+
+	return size;
+}
+
+}
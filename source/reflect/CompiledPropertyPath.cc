@@ -0,0 +1,241 @@
+#include <reflect/CompiledPropertyPath.h>
+#include <reflect/Persistent.h>
+#include <reflect/PersistentClass.h>
+
+#include <reflect/DataProperty.h>
+#include <reflect/ArrayProperty.h>
+#include <reflect/MapProperty.h>
+
+namespace reflect {
+
+CompiledPropertyPath::CompiledPropertyPath()
+	: mRoot(0)
+{
+}
+
+bool CompiledPropertyPath::Compile(string::Fragment path, const PersistentClass *root)
+{
+	mRoot = root;
+	mSteps.clear();
+
+	if(Parse(path))
+	{
+		Bind();
+		return true;
+	}
+
+	mSteps.clear();
+	return false;
+}
+
+// splits the path as <PropertyPath.AdvanceInternal> reads it.
+bool CompiledPropertyPath::Parse(string::Fragment path)
+{
+	while(path.size())
+	{
+		switch(path.data()[0])
+		{
+		case '.':
+			mSteps.push_back(Step(DerefStep));
+			path = path.substr(1);
+			break;
+
+		case '[':
+		{
+			path = path.substr(1);
+
+			string::Fragment::size_type end = path.find(']');
+			Step step(ArrayStep);
+
+			if(end == string::Fragment::npos || !PropertyPath::ParseIndex(path.substr(0, end), step.index))
+				return false;
+
+			mSteps.push_back(step);
+			path = path.substr(end + 1);
+			break;
+		}
+
+		case '{':
+		{
+			path = path.substr(1);
+
+			string::Fragment::size_type end = path.find('}');
+
+			if(end == string::Fragment::npos)
+				return false;
+
+			mSteps.push_back(Step(MapStep));
+			mSteps.back().key_text = path.substr(0, end);
+			path = path.substr(end + 1);
+			break;
+		}
+
+		default:
+		{
+			string::Fragment::size_type end = path.find_first_of(".{[");
+			if(end == string::Fragment::npos) end = path.size();
+
+			mSteps.push_back(Step(PropertyStep));
+			mSteps.back().name = string::SharedString::Copy(path.substr(0, end));
+			path = path.substr(end);
+			break;
+		}
+		}
+	}
+
+	return true;
+}
+
+// follows the static types from the root, caching what each step will find.
+void CompiledPropertyPath::Bind()
+{
+	const PersistentClass *clazz = mRoot;
+	const Property *prop = 0;
+	const Type *datum = 0;
+
+	for(std::vector<Step>::iterator step = mSteps.begin(); step != mSteps.end(); ++step)
+	{
+		switch(step->type)
+		{
+		case PropertyStep:
+			prop = 0;
+			datum = 0;
+
+			if(clazz)
+			{
+				step->clazz = clazz;
+				step->annotations = clazz->GetAnnotations(step->name);
+
+				if(0 != (prop = clazz->FindProperty(step->name)))
+				{
+					step->property = prop;
+					step->property_type = PropertyPath::PropertyType(prop);
+
+					if(const DataProperty *data_prop = prop % autocast)
+						datum = data_prop->DataType();
+				}
+			}
+
+			clazz = 0;
+			break;
+
+		case DerefStep:
+			clazz = 0;
+
+			if(const DynamicPointerType *ref_type = datum % autocast)
+				clazz = ref_type->ValueClass() % autocast;
+
+			prop = 0;
+			datum = 0;
+			break;
+
+		case ArrayStep:
+			datum = 0;
+
+			if(const ArrayProperty *array_prop = prop % autocast)
+				datum = array_prop->ItemType();
+
+			break;
+
+		case MapStep:
+			datum = 0;
+
+			if(const MapProperty *map_prop = prop % autocast)
+			{
+				datum = map_prop->ValueType();
+				step->key.BindType(map_prop->KeyType());
+
+				if(!step->key.FromString(step->key_text))
+					step->key = Variant();
+			}
+
+			break;
+		}
+	}
+}
+
+bool CompiledPropertyPath::Resolve(PropertyPath &result, Persistent *object) const
+{
+	return Resolve(result, object, object);
+}
+
+bool CompiledPropertyPath::Resolve(PropertyPath &result, const Persistent *object) const
+{
+	return Resolve(result, object, NULL);
+}
+
+bool CompiledPropertyPath::Resolve(PropertyPath &result, const Persistent *const_object, Persistent *object) const
+{
+	result = PropertyPath(const_object, object);
+
+	for(std::vector<Step>::const_iterator step = mSteps.begin();
+		step != mSteps.end() && result.GetType() != PropertyPath::Invalid;
+		++step)
+	{
+		switch(step->type)
+		{
+		case PropertyStep:
+			if(result.GetType() == PropertyPath::Object)
+			{
+				const PersistentClass *clazz = result.mConstObject->GetClass();
+
+				if(clazz == step->clazz)
+				{
+					result.mAnnotations = step->annotations;
+
+					if(step->property)
+						result.SetProperty(step->property, step->property_type);
+					else
+						result = PropertyPath();
+				}
+				else
+				{
+					// not the class the step was compiled for, look it up by name.
+					result.mAnnotations = clazz->GetAnnotations(step->name);
+
+					if(const Property *prop = clazz->FindProperty(step->name))
+						result.SetProperty(prop, PropertyPath::PropertyType(prop));
+					else
+						result = PropertyPath();
+				}
+			}
+			else
+			{
+				result = PropertyPath();
+			}
+
+			break;
+
+		case DerefStep:
+			if(result.IsRef() && result.IsDatum())
+			{
+				Dynamic *obj = result.ReadValue<Dynamic *>();
+				result = PropertyPath(obj % autocast, obj % autocast);
+			}
+			else
+			{
+				result = PropertyPath();
+			}
+
+			break;
+
+		case ArrayStep:
+			result = result.ArrayItem(step->index);
+			break;
+
+		case MapStep:
+			if(!result.IsMap())
+				result = PropertyPath();
+			else if(step->key.GetType() && step->key.GetType() == result.GetMapKeyType())
+				result = result.MapItem(step->key);
+			else
+				result = result.MapItem(string::Fragment(step->key_text));
+
+			break;
+		}
+	}
+
+	return result.GetType() != PropertyPath::Invalid;
+}
+
+}
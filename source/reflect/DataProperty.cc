@@ -7,6 +7,11 @@ DEFINE_REFLECTION(reflect::DataProperty, "reflect::DataProperty")
 
 namespace reflect {
 
+bool DataProperty::GetDirectAccess(DirectAccess &) const
+{
+	return false;
+}
+
 void DataProperty::Serialize(const void *in, void *out, reflect::Reflector &reflector) const
 {
 	if(reflector.Serializing())
@@ -1,10 +1,59 @@
 #include <reflect/Deserializer.h>
+#include <reflect/serialize/ArrayElement.h>
 
 namespace reflect {
 
+namespace {
+
+template<typename ItemType, typename SerializedType>
+bool DeserializeItems(Deserializer &deserializer, void *data, unsigned count)
+{
+	ItemType *items = static_cast<ItemType *>(data);
+	SerializedType value;
+
+	for(unsigned index = 0; index < count; ++index)
+	{
+		if(false == deserializer.Deserialize(value))
+			return false;
+
+		items[index] = ItemType(value);
+	}
+
+	return true;
+}
+
+}
+
 Deserializer::~Deserializer()
 {
 }
 
+bool Deserializer::DeserializeTextView(string::Fragment &)
+{
+	return false;
+}
+
+bool Deserializer::DeserializeArray(const Type *type, void *data, unsigned count)
+{
+	switch(serialize::ArrayElementOf(type))
+	{
+	case serialize::BoolElement: return DeserializeItems<bool, bool>(*this, data, count);
+	case serialize::CharElement: return DeserializeItems<char, long>(*this, data, count);
+	case serialize::SignedCharElement: return DeserializeItems<signed char, long>(*this, data, count);
+	case serialize::UnsignedCharElement: return DeserializeItems<unsigned char, unsigned long>(*this, data, count);
+	case serialize::ShortElement: return DeserializeItems<short, long>(*this, data, count);
+	case serialize::UnsignedShortElement: return DeserializeItems<unsigned short, unsigned long>(*this, data, count);
+	case serialize::IntElement: return DeserializeItems<int, long>(*this, data, count);
+	case serialize::UnsignedIntElement: return DeserializeItems<unsigned int, unsigned long>(*this, data, count);
+	case serialize::LongElement: return DeserializeItems<long, long>(*this, data, count);
+	case serialize::UnsignedLongElement: return DeserializeItems<unsigned long, unsigned long>(*this, data, count);
+	case serialize::FloatElement: return DeserializeItems<float, double>(*this, data, count);
+	case serialize::DoubleElement: return DeserializeItems<double, double>(*this, data, count);
+	case serialize::NoArrayElement: break;
+	}
+
+	return false;
+}
+
 
 }
@@ -0,0 +1,69 @@
+#include <reflect/ObjectArena.h>
+#include <reflect/Dynamic.h>
+
+namespace reflect {
+
+ObjectArena::ObjectArena(std::size_t slab_size)
+	: mSlabSize(slab_size)
+	, mCursor(0)
+	, mEnd(0)
+{
+}
+
+ObjectArena::~ObjectArena()
+{
+	Release();
+}
+
+void *ObjectArena::Allocate(std::size_t size, std::size_t alignment)
+{
+	std::size_t mask = alignment ? alignment - 1 : 0;
+	std::size_t padding = (0 - reinterpret_cast<std::size_t>(mCursor)) & mask;
+
+	if(mCursor && size + padding <= std::size_t(mEnd - mCursor))
+	{
+		char *result = mCursor + padding;
+		mCursor = result + size;
+		return result;
+	}
+
+	// big objects get their own slab, so the current one is not wasted.
+	if(4 * (size + mask) > mSlabSize)
+	{
+		char *slab = new char[size + mask];
+		mSlabs.push_back(slab);
+		return slab + ((0 - reinterpret_cast<std::size_t>(slab)) & mask);
+	}
+
+	char *slab = new char[mSlabSize];
+	mSlabs.push_back(slab);
+	mCursor = slab + ((0 - reinterpret_cast<std::size_t>(slab)) & mask);
+	mEnd = slab + mSlabSize;
+
+	char *result = mCursor;
+	mCursor += size;
+	return result;
+}
+
+void ObjectArena::Adopt(Dynamic *object)
+{
+	mObjects.push_back(object);
+}
+
+void ObjectArena::Release()
+{
+	while(false == mObjects.empty())
+	{
+		mObjects.back()->~Dynamic();
+		mObjects.pop_back();
+	}
+
+	for(std::size_t index = 0; index < mSlabs.size(); ++index)
+		delete [] mSlabs[index];
+
+	mSlabs.clear();
+	mCursor = 0;
+	mEnd = 0;
+}
+
+}
@@ -1,17 +1,63 @@
 #include <reflect/Class.hpp>
+#include <reflect/utility/PointerMap.hpp>
 
 namespace reflect { 
 
+// Class: ObjectType::FunctionTable
+//
+// The functions of a type and all of its parents by the identity
+// of their names, subclasses shadowing their parents.
+// Built by <Type.CompileLookups>.
+class ObjectType::FunctionTable
+{
+public:
+	FunctionTable(const ObjectType *type)
+	{
+		for(FunctionIterator it = type; it; it.next())
+		{
+			mFunctions.Insert(it->first.data(), it->second);
+		}
+	}
+
+	const function::Function *Find(const string::SharedString &name) const
+	{
+		const function::Function *const *function = name ? mFunctions.Find(name.data()) : 0;
+
+		return function ? *function : 0;
+	}
+
+private:
+	utility::PointerMap<const function::Function *> mFunctions;
+};
+
 ObjectType::ObjectType(void (*init_cb)())
 	: Type(init_cb)
 	, mFunctions(0)
     , mAnnotationMap(0)
+	, mFunctionTable(0)
+{
+}
+
+ObjectType::~ObjectType()
 {
+	delete mFunctionTable;
+}
+
+/*virtual*/ void ObjectType::BuildLookups()
+{
+	Type::BuildLookups();
+
+	delete mFunctionTable;
+	mFunctionTable = new FunctionTable(this);
 }
 
 void ObjectType::RegisterFunction(const char *name, const function::Function *func)
 {
 	Functions().insert(FunctionMap::value_type(string::SharedString::Literal(name), func));
+
+	// loaded types are rebuilt now, others when they are loaded.
+	if(mFunctionTable)
+		CompileLookups();
 }
 
 const ObjectType::FunctionMap *ObjectType::GetFunctionMap() const
@@ -37,21 +83,16 @@ const function::Function *ObjectType::FindFunction(string::Fragment name) const
 
 const function::Function *ObjectType::FindFunction(string::SharedString name) const
 {
-	for(const ObjectType *search_class = this;
-		0 != search_class;
-		search_class = search_class->Parent() % autocast)
-	{
-		if(const FunctionMap *function_map = search_class->GetFunctionMap())
-		{
-			FunctionMap::const_iterator find_it = function_map->find(name);
+	if(mFunctionTable)
+		return mFunctionTable->Find(name);
 
-			if(find_it != function_map->end())
-			{
-				return find_it->second;
-			}
-		}
+	// not loaded yet, search the maps.
+	for(FunctionIterator it = this; it; it.next())
+	{
+		if(it->first == name)
+			return it->second;
 	}
-	
+
 	return 0;
 }
 
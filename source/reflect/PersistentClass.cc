@@ -6,8 +6,11 @@
 #include <reflect/autocast.h>
 #include <reflect/Persistent.h>
 #include <reflect/PropertyPath.h>
+#include <reflect/ObjectArena.h>
+#include <reflect/utility/PointerMap.hpp>
 
 #include <cstdio>
+#include <vector>
 
 DEFINE_REFLECTION(reflect::PersistentClass, "reflect::PersistentClass")
 {
@@ -15,11 +18,100 @@ DEFINE_REFLECTION(reflect::PersistentClass, "reflect::PersistentClass")
 
 namespace reflect {
 
+// Class: PersistentClass::SerializationPlan
+//
+// The properties of a class and all of its parents, flattened into
+// <PropertyIterator> order with their tags already built, and a table
+// from each property name (by its shared string's identity) to what
+// <FindProperty> resolves it to.
+// Built when the class is initialized, and rebuilt with the other
+// lookups by <Type.CompileLookups>.
+class PersistentClass::SerializationPlan
+{
+public:
+	struct Step
+	{
+		Step(const string::SharedString &name, const Property *serialized, const Property *deserialized)
+			: tag(name.c_str(), SerializationTag::PropertyTag)
+			, serialized(serialized)
+			, deserialized(deserialized)
+		{
+		}
+
+		SerializationTag tag;
+		const Property *serialized;
+		// what the name resolves to, differs from serialized if a subclass shadows the name.
+		const Property *deserialized;
+	};
+
+	SerializationPlan(const PersistentClass *clazz)
+	{
+		// the iterator visits subclasses first, so the first of a name shadows the rest.
+		for(PropertyIterator it = clazz; it; it.next())
+		{
+			mLookup.Insert(it->first.data(), it->second);
+		}
+
+		mSteps.reserve(mLookup.Size());
+
+		for(PropertyIterator it = clazz; it; it.next())
+		{
+			mSteps.push_back(Step(it->first, it->second, Lookup(it->first)));
+		}
+	}
+
+	// Function: Lookup
+	// The property *name* resolves to in the class, or NULL.
+	const Property *Lookup(const string::SharedString &name) const
+	{
+		const Property *const *property = name ? mLookup.Find(name.data()) : 0;
+
+		return property ? *property : 0;
+	}
+
+	unsigned Size() const { return unsigned(mSteps.size()); }
+	const Step &operator [](unsigned index) const { return mSteps[index]; }
+
+	// Function: Find
+	// The index of the step deserializing *name*, or <Size> if there is none.
+	unsigned Find(string::ConstString name) const
+	{
+		for(unsigned index = 0; index < Size(); ++index)
+		{
+			if(mSteps[index].deserialized == mSteps[index].serialized && name == string::Fragment(mSteps[index].tag.Text()))
+				return index;
+		}
+
+		return Size();
+	}
+
+private:
+	std::vector<Step> mSteps;
+	utility::PointerMap<const Property *> mLookup;
+};
+
+// the plan of a class which isn't initialized, it has no properties to follow.
+static const PersistentClass::SerializationPlan sUninitializedPlan(0);
+
 PersistentClass::PersistentClass(void (*init_cb)())
     : Class(init_cb) 
     , mProperties(0)
+	, mPlan(0)
 {}
 
+PersistentClass::~PersistentClass()
+{
+	delete mPlan;
+}
+
+/*virtual*/ void PersistentClass::BuildLookups()
+{
+	Class::BuildLookups();
+
+	delete mPlan;
+	mPlan = new SerializationPlan(this);
+}
+
 Persistent *PersistentClass::Construct(void *data) const
 {
 	Persistent *result = translucent_cast<Persistent *>(Class::Construct(data));
@@ -39,9 +131,23 @@ Persistent *PersistentClass::Create() const
     return result;
 }
 
+Persistent *PersistentClass::Create(ObjectArena &arena) const
+{
+	Persistent *result = Construct(arena.Allocate(Size(), Alignment()));
+
+	if(result)
+		arena.Adopt(result);
+
+	return result;
+}
+
 void PersistentClass::RegisterProperty(const char *name, const Property *property)
 {
 	Properties().insert(PropertyMap::value_type(string::SharedString::Literal(name), property));
+
+	// initialized classes are rebuilt now, others when they are initialized.
+	if(mPlan)
+		CompileLookups();
 }
 
 const PersistentClass::PropertyMap *PersistentClass::GetPropertyMap() const
@@ -69,21 +175,16 @@ const Property *PersistentClass::FindProperty(string::Fragment name) const
 
 const Property *PersistentClass::FindProperty(string::SharedString name) const
 {
-	for(const PersistentClass *search_class = this;
-		0 != search_class;
-		search_class = search_class->Parent() % autocast)
-	{
-		if(const PropertyMap *property_map = search_class->GetPropertyMap())
-		{
-			PropertyMap::const_iterator find_it = property_map->find(name);
+	if(mPlan)
+		return mPlan->Lookup(name);
 
-			if(find_it != property_map->end())
-			{
-				return find_it->second;
-			}
-		}
+	// not loaded yet, search the maps, subclasses first.
+	for(PropertyIterator it = this; it; it.next())
+	{
+		if(it->first == name)
+			return it->second;
 	}
-	
+
 	return 0;
 }
 
@@ -96,7 +197,8 @@ void PersistentClass::SerializePointer(const Dynamic *in, Reflector &reflector)
 
 void PersistentClass::DeserializePointer(Dynamic *&out, Reflector &reflector) const
 {
-	Persistent *object = Create() % autocast;
+	ObjectArena *arena = reflector.GetDeserializer().Arena();
+	Persistent *object = (arena ? Create(*arena) : Create()) % autocast;
 
 	if(0 == object)
 		reflector.Fail();
@@ -110,13 +212,14 @@ void PersistentClass::DeserializePointer(Dynamic *&out, Reflector &reflector) co
 void PersistentClass::SerializeProperties(const Persistent *object, Reflector &reflector) const
 {
     Serializer &serializer = reflector;
+	const SerializationPlan &plan = mPlan ? *mPlan : sUninitializedPlan;
 	
-	for(PropertyIterator it = this; it; it.next())
+	for(unsigned index = 0; index < plan.Size(); ++index)
 	{
-        SerializationTag tag(it->first.c_str(), SerializationTag::PropertyTag);
-        reflector.Check(serializer.Begin(tag));
-        reflector.Check(serializer.SerializeProperty(object, it->second));
-        reflector.Check(serializer.End(tag));
+		const SerializationPlan::Step &step = plan[index];
+        reflector.Check(serializer.Begin(step.tag));
+        reflector.Check(serializer.SerializeProperty(object, step.serialized));
+        reflector.Check(serializer.End(step.tag));
 	}
 
 #if 0 // this alternate pattern serializes base classes before child classes... remove or switch back to?
@@ -142,10 +245,23 @@ void PersistentClass::DeserializeProperties(Persistent *object, Reflector &refle
 {
     SerializationTag tag;
     Deserializer &deserializer = reflector;
+	const SerializationPlan &plan = mPlan ? *mPlan : sUninitializedPlan;
+	unsigned expected = 0;
 
     while(deserializer.Begin(tag, SerializationTag::PropertyTag))
     {
-        const Property *prop = FindProperty(tag.Text().c_str());
+		string::ConstString name = tag.Text();
+        const Property *prop = 0;
+
+		// streams written by this class list the properties in plan order.
+		if(expected < plan.Size() && name == string::Fragment(plan[expected].tag.Text()))
+		{
+			prop = plan[expected++].deserialized;
+		}
+		else if(0 != (prop = FindProperty(name)))
+		{
+			expected = plan.Find(name) + 1;
+		}
 
         if(prop)
 		{
@@ -191,6 +307,11 @@ void PersistentClass::Serialize(const void *in, void *out, Reflector &reflector)
 /*virtual*/ void PersistentClass::Initialize()
 {
 	Class::Initialize();
+
+	// the properties are registered, parents initialized later are
+	// included when the lookups are built.
+	delete mPlan;
+	mPlan = new SerializationPlan(this);
 }
 
 bool PersistentClass::ResolvePropertyPath(PropertyPath &result, const Persistent *object, string::Fragment path)
@@ -3,6 +3,8 @@
 #include <reflect/PrimitiveType.hpp>
 #include <reflect/string/ConstString.h>
 #include <reflect/string/SharedString.h>
+#include <reflect/string/String.h>
+#include <reflect/serialize/NumberFormat.h>
 
 namespace reflect { namespace internals {
 
@@ -10,6 +12,86 @@ void VoidSerialize(const void *, void *, reflect::Reflector &)
 {
 }
 
+// text conversions, matching the StandardSerializer's formats.
+
+bool ParseBool(const string::Fragment &text, bool &value)
+{
+	if(text == "1" || text == "true")
+		value = true;
+	else if(text == "0" || text == "false")
+		value = false;
+	else
+		return false;
+
+	return true;
+}
+
+bool FormatBool(const bool &value, string::String &text)
+{
+	text = value ? "true" : "false";
+	return true;
+}
+
+template<typename T>
+bool ParseSigned(const string::Fragment &text, T &value)
+{
+	long parsed;
+
+	if(false == serialize::ParseSigned(text.data(), text.size(), parsed))
+		return false;
+
+	value = T(parsed);
+	return true;
+}
+
+template<typename T>
+bool FormatSigned(const T &value, string::String &text)
+{
+	char buffer[serialize::MaxNumberLength];
+	text = string::Fragment(buffer, serialize::FormatSigned(buffer, long(value)));
+	return true;
+}
+
+template<typename T>
+bool ParseUnsigned(const string::Fragment &text, T &value)
+{
+	unsigned long parsed;
+
+	if(false == serialize::ParseUnsigned(text.data(), text.size(), parsed))
+		return false;
+
+	value = T(parsed);
+	return true;
+}
+
+template<typename T>
+bool FormatUnsigned(const T &value, string::String &text)
+{
+	char buffer[serialize::MaxNumberLength];
+	text = string::Fragment(buffer, serialize::FormatHex(buffer, (unsigned long)(value)));
+	return true;
+}
+
+template<typename T>
+bool ParseDouble(const string::Fragment &text, T &value)
+{
+	double parsed;
+
+	if(false == serialize::ParseDouble(text.data(), text.size(), parsed))
+		return false;
+
+	value = T(parsed);
+	return true;
+}
+
+template<typename T>
+bool FormatDouble(const T &value, string::String &text)
+{
+	char buffer[serialize::MaxNumberLength];
+	text = string::Fragment(buffer, serialize::FormatDouble(buffer, double(value)));
+	return true;
+}
+
 } }
 
 DEFINE_STATIC_REFLECTION(void, "void")
@@ -33,6 +115,7 @@ DEFINE_STATIC_REFLECTION(bool, "bool")
 	ConversionFrom<unsigned long>();
 
 	SerializeAs<bool>();
+	TextConversions<bool, &reflect::internals::ParseBool, &reflect::internals::FormatBool>();
 }
 
 DEFINE_STATIC_REFLECTION(char, "char")
@@ -40,6 +123,7 @@ DEFINE_STATIC_REFLECTION(char, "char")
 	+ ConcreteNumeric;
 
 	SerializeAs<long>();
+	TextConversions<char, &reflect::internals::ParseSigned<char>, &reflect::internals::FormatSigned<char> >();
 }
 
 DEFINE_STATIC_REFLECTION(signed char, "signed char")
@@ -47,6 +131,7 @@ DEFINE_STATIC_REFLECTION(signed char, "signed char")
 	+ ConcreteNumeric;
 
 	SerializeAs<long>();
+	TextConversions<signed char, &reflect::internals::ParseSigned<signed char>, &reflect::internals::FormatSigned<signed char> >();
 }
 
 DEFINE_STATIC_REFLECTION(unsigned char, "unsigned char")
@@ -54,6 +139,7 @@ DEFINE_STATIC_REFLECTION(unsigned char, "unsigned char")
 	+ ConcreteNumeric;
 
 	SerializeAs<unsigned long>();
+	TextConversions<unsigned char, &reflect::internals::ParseUnsigned<unsigned char>, &reflect::internals::FormatUnsigned<unsigned char> >();
 }
 
 DEFINE_STATIC_REFLECTION(signed short, "short")
@@ -61,6 +147,7 @@ DEFINE_STATIC_REFLECTION(signed short, "short")
 	+ ConcreteNumeric;
 
 	SerializeAs<long>();
+	TextConversions<signed short, &reflect::internals::ParseSigned<signed short>, &reflect::internals::FormatSigned<signed short> >();
 }
 
 DEFINE_STATIC_REFLECTION(unsigned short, "unsigned short")
@@ -68,6 +155,7 @@ DEFINE_STATIC_REFLECTION(unsigned short, "unsigned short")
 	+ ConcreteNumeric;
 
 	SerializeAs<unsigned long>();
+	TextConversions<unsigned short, &reflect::internals::ParseUnsigned<unsigned short>, &reflect::internals::FormatUnsigned<unsigned short> >();
 }
 
 DEFINE_STATIC_REFLECTION(signed int, "int")
@@ -75,6 +163,7 @@ DEFINE_STATIC_REFLECTION(signed int, "int")
 	+ ConcreteNumeric;
 
 	SerializeAs<long>();
+	TextConversions<signed int, &reflect::internals::ParseSigned<signed int>, &reflect::internals::FormatSigned<signed int> >();
 }
 
 DEFINE_STATIC_REFLECTION(unsigned int, "unsigned int")
@@ -82,6 +171,7 @@ DEFINE_STATIC_REFLECTION(unsigned int, "unsigned int")
 	+ ConcreteNumeric;
 
 	SerializeAs<unsigned long>();
+	TextConversions<unsigned int, &reflect::internals::ParseUnsigned<unsigned int>, &reflect::internals::FormatUnsigned<unsigned int> >();
 }
 
 DEFINE_STATIC_REFLECTION(signed long, "long")
@@ -89,6 +179,7 @@ DEFINE_STATIC_REFLECTION(signed long, "long")
 	+ ConcreteNumeric;
 
 	SerializeAs<long>();
+	TextConversions<signed long, &reflect::internals::ParseSigned<signed long>, &reflect::internals::FormatSigned<signed long> >();
 }
 
 DEFINE_STATIC_REFLECTION(unsigned long, "unsigned long")
@@ -96,6 +187,7 @@ DEFINE_STATIC_REFLECTION(unsigned long, "unsigned long")
 	+ ConcreteNumeric;
 
 	SerializeAs<unsigned long>();
+	TextConversions<unsigned long, &reflect::internals::ParseUnsigned<unsigned long>, &reflect::internals::FormatUnsigned<unsigned long> >();
 }
 
 DEFINE_STATIC_REFLECTION(float, "float")
@@ -103,6 +195,7 @@ DEFINE_STATIC_REFLECTION(float, "float")
 	+ ConcreteNumeric;
 
 	SerializeAs<double>();
+	TextConversions<float, &reflect::internals::ParseDouble<float>, &reflect::internals::FormatDouble<float> >();
 }
 
 DEFINE_STATIC_REFLECTION(double, "double")
@@ -110,6 +203,7 @@ DEFINE_STATIC_REFLECTION(double, "double")
 	+ ConcreteNumeric;
 
 	SerializeAs<double>();
+	TextConversions<double, &reflect::internals::ParseDouble<double>, &reflect::internals::FormatDouble<double> >();
 }
 
 DEFINE_STATIC_REFLECTION(const char *, "c_string*")
@@ -7,9 +7,11 @@
 
 #include <reflect/serialize/StandardSerializer.h>
 #include <reflect/serialize/StandardDeserializer.h>
+#include <reflect/serialize/NumberFormat.h>
 
 #include <reflect/string/StringOutputStream.h>
 #include <reflect/string/StringInputStream.h>
+#include <reflect/BufferedInputStream.h>
 #include <reflect/string/SharedString.h>
 
 namespace reflect {
@@ -131,10 +133,9 @@ bool PropertyPath::AdvanceInternal(string::Fragment path)
 
 				if(end != string::Fragment::npos)
 				{
-					utility::InOutReflector<> io(path.substr(0, end));					
 					unsigned index;
 
-					if(io >> index)
+					if(ParseIndex(path.substr(0, end), index))
 					{
 						*this = ArrayItem(index);
 						path = path.substr(end + 1);					
@@ -180,28 +181,7 @@ bool PropertyPath::AdvanceInternal(string::Fragment path)
 				
 				if(const Property *prop = mConstObject->GetClass()->FindProperty(propname))
 				{
-					mProperty = prop;
-					mInternalType = PropertyInternalType;
-					
-					if(const MapProperty *map_prop = prop % autocast)
-					{
-						(void)map_prop;
-						mType = Map;
-					}
-					else if(const ArrayProperty *array_prop = prop % autocast)
-					{
-						(void)array_prop;
-						mType = Array;
-					}
-					else if(const DataProperty *data_prop = prop % autocast)
-					{
-						(void)data_prop;
-						mType = Data;
-					}
-					else
-					{
-						mType = Opaque;
-					}
+					SetProperty(prop, PropertyType(prop));
 				}
 				else return false;
 			}
@@ -215,6 +195,49 @@ bool PropertyPath::AdvanceInternal(string::Fragment path)
 	return true;
 }
 
+void PropertyPath::SetProperty(const reflect::Property *prop, NormalizedType type)
+{
+	mProperty = prop;
+	mInternalType = PropertyInternalType;
+	mType = type;
+}
+
+PropertyPath::NormalizedType PropertyPath::PropertyType(const reflect::Property *prop)
+{
+	if(const MapProperty *map_prop = prop % autocast)
+	{
+		(void)map_prop;
+		return Map;
+	}
+	else if(const ArrayProperty *array_prop = prop % autocast)
+	{
+		(void)array_prop;
+		return Array;
+	}
+	else if(const DataProperty *data_prop = prop % autocast)
+	{
+		(void)data_prop;
+		return Data;
+	}
+	else
+	{
+		return Opaque;
+	}
+}
+
+bool PropertyPath::ParseIndex(string::Fragment text, unsigned &index)
+{
+	unsigned long value;
+
+	if(serialize::ParseUnsigned(text.data(), unsigned(text.size()), value) && value == unsigned(value))
+	{
+		index = unsigned(value);
+		return true;
+	}
+
+	return false;
+}
+
 bool PropertyPath::WriteData(const Variant &value) const
 {
 	// optimized data path that bypasses serialization...
@@ -442,8 +465,20 @@ bool PropertyPath::Writef(const char *format, ...) const
 
 bool PropertyPath::Write(string::Fragment data) const
 {
+	// primitives are parsed without a deserializer.
+	if(const Type *type = IsDatum() ? GetDataType() : 0)
+	{
+		Variant value;
+
+		if(type->HasTextParser() && value.Construct(type)
+			&& type->ParseText(value.Opaque(), data) && WriteData(value))
+			return true;
+	}
+
+	// not a resident window: <DirectFragmentViewProperty> must not keep pointers into *data*.
 	string::StringInputStream input(data);
-	serialize::StandardDeserializer serializer(input);
+	BufferedInputStream buffered(input);
+	serialize::StandardDeserializer serializer(buffered);
 	Reflector reflector(serializer);
 
 	Write(reflector);
@@ -611,13 +646,9 @@ PropertyPath PropertyPath::MapItem(string::Fragment key) const
 	
 	if(const MapProperty *map_prop = item.mProperty % autocast)
 	{
-		string::StringInputStream key_stream(key);
-		serialize::StandardDeserializer key_deser(key_stream);
-		Reflector reflector(key_deser);
-		item.mKey.Construct(map_prop->KeyType());
-		reflector | item.mKey;
-		
-		if(!reflector.Ok())
+		item.mKey.BindType(map_prop->KeyType());
+
+		if(!item.mKey.FromString(key))
 			return PropertyPath();
 		
 		item.mType = Data;
@@ -628,6 +659,30 @@ PropertyPath PropertyPath::MapItem(string::Fragment key) const
 	return PropertyPath();
 }
 
+PropertyPath PropertyPath::MapItem(const Variant &key) const
+{
+	if(!IsMap())
+	{
+		return PropertyPath();
+	}
+
+	if(const MapProperty *map_prop = mProperty % autocast)
+	{
+		if(key.GetType() == map_prop->KeyType())
+		{
+			PropertyPath item(*this);
+
+			item.mInternalType = MapItemPropertyInternalType;
+			item.mKey = key;
+			item.mType = Data;
+
+			return item;
+		}
+	}
+
+	return PropertyPath();
+}
+
 bool PersistentClass::WriteProperty(Persistent *object, string::Fragment path, string::Fragment value) const
 {
 	PropertyPath pathresult;
@@ -678,7 +733,7 @@ bool PersistentClass::ReadStringProperty(const Persistent *object, string::Fragm
 	{
 		if(pathresult.Read(data))
 		{
-			string::StringInputStream stream(data);
+			BufferedInputStream stream(data.data(), data.size());
 			reflect::serialize::StandardDeserializer deserializer(stream);
 			
 			return deserializer | value;
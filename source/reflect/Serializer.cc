@@ -1,10 +1,55 @@
 #include <reflect/Serializer.h>
 #include <reflect/Class.hpp>
+#include <reflect/serialize/ArrayElement.h>
 
 namespace reflect {
 
+namespace {
+
+template<typename ItemType, typename SerializedType>
+bool SerializeItems(Serializer &serializer, const void *data, unsigned count)
+{
+	const ItemType *items = static_cast<const ItemType *>(data);
+
+	for(unsigned index = 0; index < count; ++index)
+	{
+		if(false == serializer.Serialize(SerializedType(items[index])))
+			return false;
+	}
+
+	return true;
+}
+
+}
+
 Serializer::~Serializer()
 {
 }
 
+void Serializer::Reserve(unsigned)
+{
+}
+
+bool Serializer::SerializeArray(const Type *type, const void *data, unsigned count)
+{
+	switch(serialize::ArrayElementOf(type))
+	{
+	case serialize::BoolElement: return SerializeItems<bool, bool>(*this, data, count);
+	case serialize::CharElement: return SerializeItems<char, long>(*this, data, count);
+	case serialize::SignedCharElement: return SerializeItems<signed char, long>(*this, data, count);
+	case serialize::UnsignedCharElement: return SerializeItems<unsigned char, unsigned long>(*this, data, count);
+	case serialize::ShortElement: return SerializeItems<short, long>(*this, data, count);
+	case serialize::UnsignedShortElement: return SerializeItems<unsigned short, unsigned long>(*this, data, count);
+	case serialize::IntElement: return SerializeItems<int, long>(*this, data, count);
+	case serialize::UnsignedIntElement: return SerializeItems<unsigned int, unsigned long>(*this, data, count);
+	case serialize::LongElement: return SerializeItems<long, long>(*this, data, count);
+	case serialize::UnsignedLongElement: return SerializeItems<unsigned long, unsigned long>(*this, data, count);
+	case serialize::FloatElement: return SerializeItems<float, double>(*this, data, count);
+	case serialize::DoubleElement: return SerializeItems<double, double>(*this, data, count);
+	case serialize::NoArrayElement: break;
+	}
+
+	return false;
+}
+
 }
@@ -5,9 +5,13 @@
 #include <reflect/Deserializer.h>
 #include <reflect/PrimitiveTypes.h>
 #include <reflect/string/ConstString.h>
+#include <reflect/string/Fragment.h>
+#include <reflect/utility/HashBytes.h>
 #include <cstring>
+#include <cctype>
 #include <cstdio>
 #include <map>
+#include <vector>
 
 namespace reflect {
 
@@ -17,6 +21,39 @@ static Type::TypeMapType sTypeMap;
 
 static Type *sFirstRoot = 0;
 
+static unsigned sLookupGeneration = 1;
+
+// open addressing index of the registered types by Type::NameHash,
+// kept at most half full and rebuilt from sTypeMap when it changes shape.
+static std::vector<Type *> sTypeIndex;
+
+static void IndexType(Type *type)
+{
+	std::size_t mask = sTypeIndex.size() - 1;
+
+	for(std::size_t index = type->NameHash() & mask; ; index = (index + 1) & mask)
+	{
+		if(sTypeIndex[index] == 0)
+		{
+			sTypeIndex[index] = type;
+			return;
+		}
+	}
+}
+
+static void RebuildTypeIndex(std::size_t count)
+{
+	std::size_t capacity = 64;
+
+	while(capacity < 2 * count)
+		capacity *= 2;
+
+	sTypeIndex.assign(capacity, static_cast<Type *>(0));
+
+	for(Type::TypeMapType::const_iterator it = sTypeMap.begin(); it != sTypeMap.end(); ++it)
+		IndexType(it->second);
+}
+
 const Type::TypeMapType &Type::GlobalTypeMap()
 {
 	return sTypeMap;
@@ -27,6 +64,7 @@ Type::Type(void (*init_cb)())
 	, mFirstChild(0)
 	, mTypeInitializerCB(init_cb)
 	, mName(0)
+	, mNameHash(0)
 	, mDepth(-1)
 	, mHierarchy(0)
 	, mNextTypeToLoad(sTypeLink)
@@ -34,6 +72,8 @@ Type::Type(void (*init_cb)())
 	, mAlignment(1)
 	, mConstructor(0)
 	, mDestructor(0)
+	, mTextParser(0)
+	, mTextFormatter(0)
 {
 	mSibling = this;
 
@@ -197,9 +237,48 @@ Type *Type::LoadTypes()
 		each->CompileHierarchy();
 	}
 
+	// members are all registered, tables only include parents' maps.
+	for(Type *each = headlink; each != 0; each = each->NextTypeToLoad())
+	{
+		each->BuildLookups();
+	}
+
+	InvalidateLookups();
+
 	return headlink;
 }
 
+unsigned Type::LookupGeneration()
+{
+	return sLookupGeneration;
+}
+
+void Type::InvalidateLookups()
+{
+	sLookupGeneration++;
+}
+
+static void BuildLookupsOfSubclasses(Type *type, void (Type::*build)())
+{
+	(type->*build)();
+
+	if(Type *child = type->Child()) do
+	{
+		BuildLookupsOfSubclasses(child, build);
+	}
+	while((child = child->Sibling()) != type->Child());
+}
+
+void Type::CompileLookups()
+{
+	BuildLookupsOfSubclasses(this, &Type::BuildLookups);
+	InvalidateLookups();
+}
+
+/*virtual*/ void Type::BuildLookups()
+{
+}
+
 void Type::ReleaseCompiledHierarchy(Type **hierarchy)
 {
 	if(mHierarchy == hierarchy)
@@ -241,6 +320,16 @@ void Type::UnloadTypes(Type *headlink)
 		each->UnlinkHierarchy();
 	}
 
+	RebuildTypeIndex(sTypeMap.size());
+
+	// the unloaded module may have registered members of the remaining types.
+	for(Type::TypeMapType::const_iterator it = sTypeMap.begin(); it != sTypeMap.end(); ++it)
+	{
+		it->second->BuildLookups();
+	}
+
+	InvalidateLookups();
+
 	TypeOf<Dynamic>()->CompileHierarchy();
 }
 
@@ -271,6 +360,7 @@ bool Type::DerivesType(const Type *other) const
 void Type::SetName(const char *name)
 {
 	mName = string::SharedString::Copy(name).c_str();
+	mNameHash = HashName(mName);
 
 	RegisterName();
 }
@@ -286,6 +376,14 @@ void Type::RegisterName()
 		fprintf(stderr, "ERROR: Type %s already registered!\n", Name());
 		//*(int*)0 = 1;
 	}
+	else if(2 * sTypeMap.size() > sTypeIndex.size())
+	{
+		RebuildTypeIndex(sTypeMap.size());
+	}
+	else
+	{
+		IndexType(this);
+	}
 }
 
 Type *Type::AnyRootType()
@@ -295,12 +393,12 @@ Type *Type::AnyRootType()
 
 Type *Type::FindType(const char *name)
 {
-	if(string::SharedString str_name = string::SharedString::Find(name))
-	{
-		return FindType(str_name);
-	}
+	if(0 == name)
+		return 0;
 
-	return 0;
+	string::Fragment fragment(name);
+
+	return FindType(fragment, HashName(fragment));
 }
 
 Type *Type::FindType(string::FoundSharedString name)
@@ -312,6 +410,27 @@ Type *Type::FindType(string::FoundSharedString name)
 	return 0;
 }
 
+Type *Type::FindType(const string::Fragment &name, unsigned hash)
+{
+	if(sTypeIndex.empty())
+		return 0;
+
+	std::size_t mask = sTypeIndex.size() - 1;
+
+	for(std::size_t index = hash & mask; Type *type = sTypeIndex[index]; index = (index + 1) & mask)
+	{
+		if(type->mNameHash == hash && name == string::Fragment(type->mName))
+			return type;
+	}
+
+	return 0;
+}
+
+unsigned Type::HashName(const string::Fragment &name)
+{
+	return utility::HashBytes(name.data(), name.size());
+}
+
 const char *Type::Name() const
 {
 	return mName;
@@ -412,6 +531,34 @@ bool Type::ConvertValue(void *opaque, const void *src, const Type *from) const
 	}
 }
 
+void Type::SetTextConversions(TextParser parser, TextFormatter formatter)
+{
+	mTextParser = parser;
+	mTextFormatter = formatter;
+}
+
+bool Type::ParseText(void *opaque, const string::Fragment &text) const
+{
+	if(0 == mTextParser)
+		return false;
+
+	// the deserializer would skip the surrounding space.
+	const char *begin = text.data(), *end = begin + text.size();
+
+	while(begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+		begin++;
+
+	while(begin != end && std::isspace(static_cast<unsigned char>(end[-1])))
+		end--;
+
+	return (*mTextParser)(opaque, string::Fragment(begin, string::Fragment::size_type(end - begin)));
+}
+
+bool Type::FormatText(const void *opaque, string::String &text) const
+{
+	return mTextFormatter && (*mTextFormatter)(opaque, text);
+}
+
 class TypeType : public Class
 {
 public:
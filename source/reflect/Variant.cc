@@ -2,17 +2,88 @@
 #include <reflect/Reflector.h>
 #include <reflect/utility/InOutReflector.h>
 #include <reflect/string/StringInputStream.h>
+#include <reflect/BufferedInputStream.h>
 #include <reflect/PrimitiveTypes.h>
+#include <cstring>
+#include <new>
+
+#if defined(REFLECT_ATOMIC_VARIANT) && defined(_WIN32)
+# define WIN32_LEAN_AND_MEAN
+# include <windows.h>
+#endif
 
 namespace reflect {
 
+namespace {
+
+// heap allocated values are preceded by their control block,
+// which destroys the value when the last variant lets go of it.
+struct ControlBlock
+{
+	long refs;
+	const Type *type;
+	void *data;
+};
+
+// keeps the value after the block aligned like new char[] would.
+enum { ControlBlockSize = (sizeof(ControlBlock) + 15) & ~15 };
+
+ControlBlock *BlockOf(char *allocation)
+{
+	return reinterpret_cast<ControlBlock *>(allocation);
+}
+
+char *NewBlock(std::size_t size)
+{
+	char *allocation = new char[ControlBlockSize + size];
+	ControlBlock *block = new(allocation) ControlBlock;
+	block->refs = 1;
+	block->type = 0;
+	block->data = 0;
+	return allocation;
+}
+
+void AcquireBlock(char *allocation)
+{
+#if !defined(REFLECT_ATOMIC_VARIANT)
+	++BlockOf(allocation)->refs;
+#elif defined(_WIN32)
+	InterlockedIncrement(&BlockOf(allocation)->refs);
+#else
+	__sync_add_and_fetch(&BlockOf(allocation)->refs, 1);
+#endif
+}
+
+void ReleaseBlock(char *allocation)
+{
+	ControlBlock *block = BlockOf(allocation);
+
+#if !defined(REFLECT_ATOMIC_VARIANT)
+	long refs = --block->refs;
+#elif defined(_WIN32)
+	long refs = InterlockedDecrement(&block->refs);
+#else
+	long refs = __sync_sub_and_fetch(&block->refs, 1);
+#endif
+
+	if(0 == refs)
+	{
+		if(block->data)
+			block->type->Destruct(block->data);
+
+		delete [] allocation;
+	}
+}
+
+}
+
 Variant::Variant()
 	: mAllocation(0)
 	, mType(0)
 	, mConstData(0)
 	, mData(0)
 {
-	mLink = this;
+	mLink = mPrevLink = this;
 }
 
 Variant::Variant(void *opaque, const Type *type)
@@ -21,7 +92,7 @@ Variant::Variant(void *opaque, const Type *type)
 	, mConstData(opaque)
 	, mData(opaque)
 {
-	mLink = this;
+	mLink = mPrevLink = this;
 }
 
 Variant::Variant(const void *opaque, const Type *type)
@@ -30,16 +101,16 @@ Variant::Variant(const void *opaque, const Type *type)
 	, mConstData(opaque)
 	, mData(0)
 {
-	mLink = this;
+	mLink = mPrevLink = this;
 }
 
 Variant::Variant(const Variant &other)
-	: mAllocation(other.mAllocation)
-	, mType(other.mType)
-	, mConstData(other.mConstData)
-	, mData(other.mData)
+	: mAllocation(0)
+	, mType(0)
+	, mConstData(0)
+	, mData(0)
 {
-	mLink = this;	
+	mLink = mPrevLink = this;
 	Share(other);
 }
 
@@ -63,73 +134,141 @@ const Variant &Variant::operator =(const Variant &other)
 	if(this != &other)
 	{
 		Release();
-
-		mAllocation = other.mAllocation;
-		mType = other.mType;
-		mConstData = other.mConstData;
-		mData = other.mData;
 		Share(other);
 	}
 	
 	return *this;
 }
 
+void Variant::Swap(Variant &other)
+{
+	Variant temp(other);
+	other = *this;
+	*this = temp;
+}
+
+bool Variant::ConstructValue(const Type *type)
+{
+	mType = type;
+
+	// only primitives are known to be copyable by conversion to their own type,
+	// which is what <Share> does with inline values.
+	if(type->Size() <= sizeof(mInline.bytes)
+		&& 0 == (reinterpret_cast<std::size_t>(mInline.bytes) & (type->Alignment() - 1))
+		&& type->GetClass()->Derives<PrimitiveType>()
+		&& type->CanConvertFrom(type))
+	{
+		mAllocation = mInline.bytes;
+		mConstData = mData = type->Construct(mAllocation);
+	}
+	else
+	{
+		mAllocation = NewBlock(type->Size());
+		mConstData = mData = type->Construct(mAllocation + ControlBlockSize);
+		BlockOf(mAllocation)->type = type;
+		BlockOf(mAllocation)->data = mData;
+	}
+
+	return true;
+}
+
+void Variant::Promote()
+{
+	if(false == OwnsInline())
+		return;
+
+	if(mData)
+	{
+		char *allocation = NewBlock(mType->Size());
+		void *data = mType->Construct(allocation + ControlBlockSize);
+		mType->ConvertValue(data, mConstData, mType);
+		mType->Destruct(mData);
+		BlockOf(allocation)->type = mType;
+		BlockOf(allocation)->data = data;
+		mAllocation = allocation;
+		mConstData = mData = data;
+	}
+	else
+	{
+		mAllocation = NewBlock(sizeof(void *));
+		std::memcpy(mAllocation + ControlBlockSize, mInline.bytes, sizeof(void *));
+		mConstData = mAllocation + ControlBlockSize;
+	}
+}
+
 void Variant::ClearAllocation()
 {
-	if(mAllocation)
+	if(OwnsInline())
 	{
 		// Note: when a variant is created on a string literal,
-		// it allocates a pointer value to use to point to the begining of the
+		// it holds a pointer value to use to point to the begining of the
 		// string.  In (only) this case, there is an allocation but no mData pointer.
 		// It shouldn't be a problem to not "destruct" a pointer.
 		if(mData) mType->Destruct(mData);
-		delete [] mAllocation;
-		mType = 0;
-		mConstData = mData = 0;
 	}
+	else if(mAllocation)
+	{
+		ReleaseBlock(mAllocation);
+	}
+
+	mAllocation = 0;
+	mConstData = mData = 0;
 }
 
 void Variant::Release()
 {
-	bool copy_of_allocation_found = false;
-	Variant *prev = 0;
+	// leave the alias ring.
+	mPrevLink->mLink = mLink;
+	mLink->mPrevLink = mPrevLink;
+	mLink = mPrevLink = this;
 
-	// traverse the ring list for other variants, check if they
-	// have the same allocation, remember the previous variant in *prev*
-	for(Variant *link = mLink; 
-	    link != this;
-        prev = link, link = link->mLink)
+	ClearAllocation();
+}
+
+void Variant::Share(const Variant &other)
+{
+	mType = other.mType;
+
+	if(other.OwnsInline())
 	{
-		if(link->mAllocation == mAllocation)
+		// inline values are copied, see <ConstructValue>.
+		mAllocation = mInline.bytes;
+
+		if(other.mData)
 		{
-			copy_of_allocation_found = true;
+			mConstData = mData = mType->Construct(mAllocation);
+			mType->ConvertValue(mData, other.mConstData, mType);
+		}
+		else
+		{
+			// a pointer to a string literal, see <FromConstRef>.
+			std::memcpy(mAllocation, other.mAllocation, sizeof(void *));
+			mConstData = mAllocation;
+			mData = 0;
 		}
 	}
+	else
+	{
+		mAllocation = other.mAllocation;
+		mConstData = other.mConstData;
+		mData = other.mData;
 
-	// if *prev* is set, then 
-	// there is more than one variant in this ring,
-	// unlink it from this.
-	if(prev)
-    {
-		prev->mLink = mLink;
-		mLink = this;
-    }
-
-	// if noone is sharing this allocation, clear it.
-	if(false == copy_of_allocation_found)
-		ClearAllocation();
+		if(mAllocation)
+			AcquireBlock(mAllocation);
+	}
 }
 
-void Variant::Share(const Variant &other)
+void Variant::LinkAlias(Variant &other)
 {
 	mLink = other.mLink;
+	mPrevLink = &other;
+	other.mLink->mPrevLink = this;
 	other.mLink = this;
 }
 
 void Variant::BindType(const Type *type)
 {
 	Release();
-	mConstData = mData = 0;
 	mType = type;
 }
 
@@ -151,7 +290,8 @@ bool Variant::Construct(const Type *type, bool own_data)
 	{
 		// if own_data is not requested or,... it is but data is already owned,
 		// then success.
-		if(false == own_data || (0 != mAllocation && this == mLink))
+		if(false == own_data || OwnsInline()
+			|| (0 != mAllocation && 1 == BlockOf(mAllocation)->refs && this == mLink))
 			return true;
 	}
 	
@@ -164,25 +304,16 @@ bool Variant::Construct(const Type *type, bool own_data)
 	}
 	
 	Release();
-	mType = type;
-	mAllocation = new char[mType->Size()];
-	mConstData = mData = mType->Construct(mAllocation);
 
-	return true;
+	return ConstructValue(type);
 }
 
 void Variant::Assimilate(Variant &value)
 {
 	Release();
-
-	mType = value.mType;
-	mConstData = mData = value.mData;
-	mAllocation = value.mAllocation;
-
+	Share(value);
 	value.Release();
-	value.mAllocation = 0;
 	value.mType = 0;
-	value.mConstData = value.mData = 0;
 }
 
 bool Variant::ConvertToType(const Type *type)
@@ -248,11 +379,12 @@ bool Variant::ConstRef(const Variant &value)
 		return Set(value);
 	}
 
+	const Type *type = mType;
 	Release();
-	mAllocation = value.mAllocation;
-	mData = 0;
-	mConstData = value.mConstData;
+	const_cast<Variant &>(value).Promote();
 	Share(value);
+	mType = type;
+	mData = 0;
 	
 	return true;
 }
@@ -268,11 +400,11 @@ bool Variant::Ref(const Variant &value)
 		return false;
 	}
 
+	const Type *type = mType;
 	Release();
-	mAllocation = value.mAllocation;
-	mData = value.mData;
-	mConstData = value.mConstData;
+	const_cast<Variant &>(value).Promote();
 	Share(value);
+	mType = type;
 	
 	return true;
 }
@@ -286,9 +418,7 @@ bool Variant::Alias(Variant &other)
 	
 	if(mType == other.mType)
 	{
-		mAllocation = other.mAllocation;
-		mData = other.mData;
-		mConstData = other.mConstData;
+		other.Promote();
 		Share(other);
 		return true;
 	}
@@ -297,12 +427,11 @@ bool Variant::Alias(Variant &other)
 		// don't bother converting if we can't convert back.
 		if(mType->CanConvertFrom(other.mType) && other.mType->CanConvertFrom(mType))
 		{
-			mAllocation = new char[mType->Size()];
-			mConstData = mData = mType->Construct(mAllocation);
+			ConstructValue(mType);
 			bool result = Set(other);
 			if(result)
 			{
-				Share(other);
+				LinkAlias(other);
 				return true;
 			}
 			else
@@ -384,6 +513,11 @@ const Type *Variant::GetType() const
 
 string::String Variant::ToString() const
 {
+	string::String text;
+
+	if(mType && mConstData && mType->FormatText(mConstData, text))
+		return text;
+
 	utility::InOutReflector<> io;
 	
 	Reflector reflector(io.GetSerializer());
@@ -400,8 +534,13 @@ bool Variant::FromString(string::Fragment fragment)
 
 	if(Construct())
 	{
+		if(mType->ParseText(mData, fragment))
+			return true;
+
+		// buffered, but not resident: the value mustn't keep views of *fragment*.
 		string::StringInputStream input(fragment);
-		serialize::StandardDeserializer deserializer(input);
+		BufferedInputStream buffered(input);
+		serialize::StandardDeserializer deserializer(buffered);
 		Reflector reflector(deserializer);
 		
 		return reflector | *this;
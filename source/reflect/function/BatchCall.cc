@@ -0,0 +1,289 @@
+#include <reflect/function/BatchCall.h>
+#include <reflect/ArrayProperty.h>
+#include <reflect/Dynamic.h>
+#include <reflect/Class.h>
+#include <reflect/autocast.h>
+#include <reflect/Variant.h>
+#include <reflect/string/StringPool.h>
+#include <reflect/utility/Thread.h>
+
+#include <vector>
+
+namespace reflect { namespace function {
+
+// pointers to related classes are converted, and checked, item by item.
+static bool CanConvertColumn(const Type *to, const Type *from)
+{
+	if(to->CanConvertFrom(from))
+		return true;
+
+	const DynamicPointerType *to_pointer = to % autocast;
+	const DynamicPointerType *from_pointer = from % autocast;
+
+	return to_pointer && from_pointer
+		&& (to_pointer->ValueClass()->DerivesType(from_pointer->ValueClass())
+		 || from_pointer->ValueClass()->DerivesType(to_pointer->ValueClass()));
+}
+
+BatchCall::BatchCall(const Function *function)
+	: mFunction(function)
+	, mInvoke(0)
+{
+	const Type *parameter_types[Function::MaxParameters];
+
+	for(int index = 0; index < function->NumParameters(); index++)
+		parameter_types[index] = function->ParameterType(index);
+
+	// the function's own signature, for its typed entry point.
+	mInvoke = function->FindInvoke(0, parameter_types, function->NumParameters(), ~0u);
+}
+
+bool BatchCall::Argument(int index, const Type *type, const void *items, std::ptrdiff_t stride)
+{
+	if(index < 0 || index >= mFunction->NumParameters() || 0 == type)
+		return false;
+
+	bool is_mutable = false;
+	const Type *parameter_type = mFunction->ClassifyParameter(index, is_mutable);
+	bool convert = type != parameter_type;
+
+	if(is_mutable || (convert && !CanConvertColumn(parameter_type, type)))
+		return false;
+
+	Column &column = mColumns[index];
+	column.type = type;
+	column.data = static_cast<char *>(const_cast<void *>(items));
+	column.stride = stride;
+	column.convert = convert;
+	return true;
+}
+
+bool BatchCall::Constant(int index, const Variant &value)
+{
+	if(index < 0 || index >= mFunction->NumParameters())
+		return false;
+
+	Variant &constant = mConstants[index];
+	constant = Variant();
+
+	return constant.Set(value)
+		&& Argument(index, constant.GetType(), constant.ConstOpaque(), 0);
+}
+
+bool BatchCall::MutableArgument(int index, const Type *type, void *items, std::ptrdiff_t stride)
+{
+	if(index < 0 || index >= mFunction->NumParameters() || type != mFunction->ParameterType(index))
+		return false;
+
+	Column &column = mColumns[index];
+	column.type = type;
+	column.data = static_cast<char *>(items);
+	column.stride = stride;
+	column.convert = false;
+	return true;
+}
+
+bool BatchCall::Results(const Type *type, void *items, std::ptrdiff_t stride)
+{
+	const Type *result_type = mFunction->ResultType();
+	bool convert = type != result_type;
+
+	if(0 == type || (convert && !CanConvertColumn(type, result_type)))
+		return false;
+
+	mResults.type = type;
+	mResults.data = static_cast<char *>(items);
+	mResults.stride = stride;
+	mResults.convert = convert;
+	return true;
+}
+
+bool BatchCall::Ready() const
+{
+	if(0 == mInvoke)
+		return false;
+
+	for(int index = 0; index < mFunction->NumParameters(); index++)
+	{
+		if(0 == mColumns[index].type)
+			return false;
+	}
+
+	return true;
+}
+
+bool BatchCall::Call(unsigned count, unsigned threads) const
+{
+	return !mFunction->IsMethod() && Ready() && Dispatch(0, count, threads);
+}
+
+bool BatchCall::Call(const Type *object_type, void *const *objects, unsigned count, unsigned threads) const
+{
+	return mFunction->IsMethod()
+		&& object_type && object_type->DerivesType(mFunction->CallObjectType())
+		&& Ready()
+		&& Dispatch(objects, count, threads);
+}
+
+bool BatchCall::CallItems(const ArrayProperty *array, void *object, unsigned threads) const
+{
+	const Type *object_type = mFunction->CallObjectType();
+
+	if(0 == object_type || false == Ready())
+		return false;
+
+	unsigned count = array->Size(object);
+	std::vector<void *> objects(count);
+	const Type *item_type = array->ItemType();
+	bool pointers = 0 != static_cast<const DynamicPointerType *>(item_type % autocast);
+
+	if(false == pointers && false == item_type->DerivesType(object_type))
+		return false;
+
+	for(unsigned index = 0; index < count; index++)
+	{
+		Variant item;
+
+		if(false == array->RefData(object, object, index, item))
+			return false;
+
+		if(pointers)
+		{
+			Dynamic *dynamic = 0;
+
+			if(false == item.ReadValue(dynamic)
+			|| 0 == dynamic
+			|| false == dynamic->GetClass()->DerivesType(object_type))
+				return false;
+
+			objects[index] = opaque_cast(dynamic);
+		}
+		else if(0 == (objects[index] = item.Opaque()))
+		{
+			return false;
+		}
+	}
+
+	return count == 0 || Dispatch(&objects[0], count, threads);
+}
+
+struct BatchCall::Range
+{
+	const BatchCall *call;
+	void *const *objects;
+	unsigned begin, end;
+	string::StringPoolContext *context;
+	bool ok;
+};
+
+void BatchCall::RunRange(void *data)
+{
+	Range &range = *static_cast<Range *>(data);
+	string::StringPoolContext::Inherit inherit(range.context);
+	range.ok = range.call->Run(range.objects, range.begin, range.end);
+}
+
+bool BatchCall::Dispatch(void *const *objects, unsigned count, unsigned threads) const
+{
+	if(threads > count)
+		threads = count;
+
+	if(threads <= 1)
+		return Run(objects, 0, count);
+
+	std::vector<Range> ranges(threads);
+	utility::Thread *workers = new utility::Thread[threads - 1];
+
+	for(unsigned index = 0; index < threads; index++)
+	{
+		Range &range = ranges[index];
+		range.call = this;
+		range.objects = objects;
+		range.begin = unsigned(count * (unsigned long long)index / threads);
+		range.end = unsigned(count * (unsigned long long)(index + 1) / threads);
+		range.context = string::StringPoolContext::GetContext();
+		range.ok = false;
+
+		// the last range runs here, as do ranges whose thread didn't start.
+		if(index + 1 < threads && workers[index].Start(&RunRange, &range))
+			continue;
+
+		range.ok = Run(objects, range.begin, range.end);
+	}
+
+	delete [] workers;
+
+	bool result = true;
+
+	for(unsigned index = 0; index < threads; index++)
+		result = result && ranges[index].ok;
+
+	return result;
+}
+
+bool BatchCall::Run(void *const *objects, unsigned begin, unsigned end) const
+{
+	const int parameters = mFunction->NumParameters();
+	const Type *result_type = mFunction->ResultType();
+
+	// converted values, made once per range.
+	Variant scratch[Function::MaxParameters];
+	Variant result_scratch;
+	void *args[Function::MaxParameters];
+
+	for(int index = 0; index < parameters; index++)
+	{
+		if(mColumns[index].convert && !scratch[index].Construct(mFunction->ParameterType(index)))
+			return false;
+	}
+
+	if(mResults.convert && !result_scratch.Construct(result_type))
+		return false;
+
+	bool result = true;
+
+	for(unsigned call = begin; call < end; call++)
+	{
+		bool converted = true;
+
+		for(int index = 0; index < parameters && converted; index++)
+		{
+			const Column &column = mColumns[index];
+			char *item = column.data + column.stride * std::ptrdiff_t(call);
+
+			if(column.convert)
+			{
+				args[index] = scratch[index].Opaque();
+				converted = scratch[index].GetType()->ConvertValue(args[index], item, column.type);
+			}
+			else
+			{
+				args[index] = item;
+			}
+		}
+
+		// a call missing an argument is skipped, leaving its result alone.
+		if(false == converted)
+		{
+			result = false;
+			continue;
+		}
+
+		void *object = objects ? objects[call] : 0;
+		char *target = mResults.data ? mResults.data + mResults.stride * std::ptrdiff_t(call) : 0;
+
+		if(mResults.convert)
+		{
+			mInvoke(mFunction, object, args, result_scratch.Opaque());
+			result = mResults.type->ConvertValue(target, result_scratch.Opaque(), result_type) && result;
+		}
+		else
+		{
+			mInvoke(mFunction, object, args, target);
+		}
+	}
+
+	return result;
+}
+
+} }
@@ -1,6 +1,8 @@
 #include <reflect/function/Function.h>
 #include <reflect/ObjectType.hpp>
 
+#include <new>
+
 DEFINE_STATIC_REFLECTION(reflect::function::Function, "reflect::function::Function")
 {
   using namespace reflect::function;
@@ -28,16 +30,45 @@ bool Function::IsMethod() const
   return mObjectType != 0;
 }
 
-Function::Function(const char *name, const Type *object_type, ParameterTypeFun arg_type_fun, const Type *result_type)
+Function::Function(const char *name, const Type *object_type, ParameterTypeFun arg_type_fun, const Type *result_type, InvokeFunction invoke)
   : mName(name)
   , mObjectType(object_type)
   , mParameterTypeFun(arg_type_fun)
   , mResultType(result_type)
+  , mInvoke(invoke)
+  , mMutableParameters(0)
 {
   mParameterCount = 0;
 
-  while((*mParameterTypeFun)(mParameterCount, 0))
+  bool mut = false;
+
+  while(mParameterCount < MaxParameters
+    && 0 != (mParameterTypes[mParameterCount] = (*mParameterTypeFun)(mParameterCount, &mut)))
+  {
+    if(mut)
+      mMutableParameters |= 1u << mParameterCount;
+
+    mut = false;
     mParameterCount++;
+  }
+}
+
+Function::InvokeFunction Function::FindInvoke(const Type *result_type, const Type *const *parameter_types, int count, unsigned mutable_parameters) const
+{
+  if(count != mParameterCount
+  || (result_type && result_type != mResultType)
+  || 0 != (mMutableParameters & ~mutable_parameters))
+  {
+    return 0;
+  }
+
+  for(int i = 0; i < count; i++)
+  {
+    if(parameter_types[i] != mParameterTypes[i])
+      return 0;
+  }
+
+  return mInvoke;
 }
 
 bool Function::Call(const Parameters &params, Variant &result) const
@@ -70,14 +101,19 @@ bool Function::Call(const Variant &self, const Parameters &params, Variant &resu
 }
 
 Parameters::Parameters(const Function *fun)
+  : mCount(fun->NumParameters())
+  , mParams(0)
 {
-  mCount = fun->NumParameters();
-  mParams = mCount ? new Variant[mCount] : 0;
+  if(mCount > InlineParameters)
+    mParams = static_cast<Variant *>(operator new(mCount * sizeof(Variant)));
+  else if(mCount)
+    mParams = reinterpret_cast<Variant *>(mInline.bytes);
 
   for(int param_idx = 0; param_idx < mCount; param_idx++)
   {
+    new(mParams + param_idx) Variant();
     mParams[param_idx]
-      .BindType(fun->ParameterType(param_idx));
+      .BindType(fun->mParameterTypes[param_idx]);
   }
 }
 
@@ -88,10 +124,17 @@ bool Parameters::ValidForFunction(const Function *function) const
   
   for(int i = 0; i < function->NumParameters(); i++)
   {
-    bool mut = false;
-    const Type *expected_type = function->ClassifyParameter(i, mut);
+    const Variant &param = Params()[i];
+    const Type *expected_type = function->mParameterTypes[i];
+    bool mut = 0 != (function->mMutableParameters & (1u << i));
 
-    if(mut ? !Params()[i].CanRefAs(expected_type) : !Params()[i].CanConstRefAs(expected_type))
+    if(param.GetType() == expected_type)
+    {
+      // still the bound type, only the data needs checking.
+      if(0 == (mut ? param.Opaque() : param.ConstOpaque()))
+        return false;
+    }
+    else if(mut ? !param.CanRefAs(expected_type) : !param.CanConstRefAs(expected_type))
     {
       return false;
     }
@@ -102,8 +145,11 @@ bool Parameters::ValidForFunction(const Function *function) const
 
 Parameters::~Parameters()
 {
-  if(mParams)
-    delete [] mParams;
+  for(int param_idx = mCount; param_idx-- > 0; )
+    mParams[param_idx].~Variant();
+
+  if(mParams && mParams != reinterpret_cast<Variant *>(mInline.bytes))
+    operator delete(mParams);
 }
 
 Parameters::FunctionParameter::FunctionParameter(Parameters &rs, int idx)
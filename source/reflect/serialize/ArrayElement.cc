@@ -0,0 +1,46 @@
+#include <reflect/serialize/ArrayElement.h>
+#include <reflect/PrimitiveTypes.h>
+
+namespace reflect { namespace serialize {
+
+ArrayElement ArrayElementOf(const Type *type)
+{
+	if(type == TypeOf<float>()) return FloatElement;
+	if(type == TypeOf<double>()) return DoubleElement;
+	if(type == TypeOf<int>()) return IntElement;
+	if(type == TypeOf<unsigned int>()) return UnsignedIntElement;
+	if(type == TypeOf<long>()) return LongElement;
+	if(type == TypeOf<unsigned long>()) return UnsignedLongElement;
+	if(type == TypeOf<short>()) return ShortElement;
+	if(type == TypeOf<unsigned short>()) return UnsignedShortElement;
+	if(type == TypeOf<char>()) return CharElement;
+	if(type == TypeOf<signed char>()) return SignedCharElement;
+	if(type == TypeOf<unsigned char>()) return UnsignedCharElement;
+	if(type == TypeOf<bool>()) return BoolElement;
+
+	return NoArrayElement;
+}
+
+unsigned ArrayElementSize(ArrayElement element)
+{
+	switch(element)
+	{
+	case BoolElement: return sizeof(bool);
+	case CharElement: return sizeof(char);
+	case SignedCharElement: return sizeof(signed char);
+	case UnsignedCharElement: return sizeof(unsigned char);
+	case ShortElement: return sizeof(short);
+	case UnsignedShortElement: return sizeof(unsigned short);
+	case IntElement: return sizeof(int);
+	case UnsignedIntElement: return sizeof(unsigned int);
+	case LongElement: return sizeof(long);
+	case UnsignedLongElement: return sizeof(unsigned long);
+	case FloatElement: return sizeof(float);
+	case DoubleElement: return sizeof(double);
+	case NoArrayElement: break;
+	}
+
+	return 0;
+}
+
+} }
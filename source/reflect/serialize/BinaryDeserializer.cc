@@ -0,0 +1,648 @@
+#include <reflect/serialize/BinaryDeserializer.h>
+#include <reflect/InputStream.h>
+#include <reflect/SerializationTag.h>
+#include <reflect/Reflector.h>
+#include <reflect/Property.h>
+#include <reflect/autocast.h>
+#include <reflect/EnumType.h>
+#include <reflect/string/Fragment.h>
+#include <reflect/string/MutableString.h>
+#include <cstring>
+#include <climits>
+
+namespace reflect { namespace serialize {
+
+namespace {
+
+long UnZigZag(unsigned long value)
+{
+	return static_cast<long>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+bool LittleEndian()
+{
+	const unsigned short probe = 1;
+	return 1 == *reinterpret_cast<const unsigned char *>(&probe);
+}
+
+// an item of a <BinaryArray>, as whichever of integer or real it was written as.
+struct ArrayItem
+{
+	unsigned long long bits;
+	bool is_signed;
+	bool is_real;
+	double real;
+
+	template<typename ItemType>
+	ItemType As() const
+	{
+		return is_real ? ItemType(real)
+			: is_signed ? ItemType(static_cast<long long>(bits))
+			: ItemType(bits);
+	}
+};
+
+ArrayItem DecodeArrayItem(ArrayElement element, const unsigned char *bytes, unsigned width)
+{
+	ArrayItem item = { 0, false, false, 0 };
+
+	for(unsigned byte = 0; byte < width; byte++)
+	{
+		item.bits |= static_cast<unsigned long long>(bytes[byte]) << (byte * 8);
+	}
+
+	switch(element)
+	{
+	case CharElement:
+	case SignedCharElement:
+	case ShortElement:
+	case IntElement:
+	case LongElement:
+		if(width < 8 && (item.bits >> (width * 8 - 1)))
+			item.bits |= ~0ull << (width * 8);
+		item.is_signed = true;
+		break;
+	case FloatElement:
+		{
+			unsigned int bits = static_cast<unsigned int>(item.bits);
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			item.real = value;
+			item.is_real = true;
+		}
+		break;
+	case DoubleElement:
+		std::memcpy(&item.real, &item.bits, sizeof(item.real));
+		item.is_real = true;
+		break;
+	default:
+		break;
+	}
+
+	return item;
+}
+
+void StoreArrayItem(ArrayElement element, void *data, unsigned index, const ArrayItem &item)
+{
+	switch(element)
+	{
+	case BoolElement: static_cast<bool *>(data)[index] = item.is_real ? item.real != 0 : item.bits != 0; break;
+	case CharElement: static_cast<char *>(data)[index] = item.As<char>(); break;
+	case SignedCharElement: static_cast<signed char *>(data)[index] = item.As<signed char>(); break;
+	case UnsignedCharElement: static_cast<unsigned char *>(data)[index] = item.As<unsigned char>(); break;
+	case ShortElement: static_cast<short *>(data)[index] = item.As<short>(); break;
+	case UnsignedShortElement: static_cast<unsigned short *>(data)[index] = item.As<unsigned short>(); break;
+	case IntElement: static_cast<int *>(data)[index] = item.As<int>(); break;
+	case UnsignedIntElement: static_cast<unsigned int *>(data)[index] = item.As<unsigned int>(); break;
+	case LongElement: static_cast<long *>(data)[index] = item.As<long>(); break;
+	case UnsignedLongElement: static_cast<unsigned long *>(data)[index] = item.As<unsigned long>(); break;
+	case FloatElement: static_cast<float *>(data)[index] = item.As<float>(); break;
+	case DoubleElement: static_cast<double *>(data)[index] = item.As<double>(); break;
+	case NoArrayElement: break;
+	}
+}
+
+}
+
+BinaryDeserializer::BinaryDeserializer(InputStream &stream)
+	: mBuffer(stream, BufferedInputStream::NoReadAhead)
+	, mInput(mBuffer)
+	, mDeserializingText(false)
+	, mTextRemaining(0)
+{
+}
+
+BinaryDeserializer::BinaryDeserializer(BufferedInputStream &stream)
+	: mInput(stream)
+	, mDeserializingText(false)
+	, mTextRemaining(0)
+{
+}
+
+int BinaryDeserializer::Peek()
+{
+	return mInput.Peek();
+}
+
+int BinaryDeserializer::Read()
+{
+	int result = mInput.Peek();
+
+	if(result >= 0)
+		mInput.Consume(1);
+
+	return result;
+}
+
+bool BinaryDeserializer::ReadBytes(void *data, unsigned long nbytes)
+{
+	return mInput.Read(data, InputStream::size_type(nbytes)) == InputStream::size_type(nbytes);
+}
+
+bool BinaryDeserializer::SkipBytes(unsigned long nbytes)
+{
+	char discard[256];
+
+	while(nbytes)
+	{
+		unsigned long chunk = nbytes < sizeof(discard) ? nbytes : sizeof(discard);
+
+		if(false == ReadBytes(discard, chunk))
+			return false;
+
+		nbytes -= chunk;
+	}
+
+	return true;
+}
+
+bool BinaryDeserializer::ReadVarint(unsigned long &value)
+{
+	value = 0;
+
+	for(unsigned shift = 0; shift < sizeof(unsigned long) * 8; shift += 7)
+	{
+		int byte = Read();
+
+		if(byte < 0)
+			return false;
+
+		value |= static_cast<unsigned long>(byte & 0x7F) << shift;
+
+		if(0 == (byte & 0x80))
+			return true;
+	}
+
+	return false; // malformed stream
+}
+
+bool BinaryDeserializer::ReadName(char *buffer, unsigned capacity, unsigned &length)
+{
+	unsigned long size;
+
+	if(false == ReadVarint(size))
+		return false;
+
+	length = size < capacity ? unsigned(size) : capacity;
+
+	return ReadBytes(buffer, length) && SkipBytes(size - length);
+}
+
+bool BinaryDeserializer::ReadNumber(BinaryCode &code, unsigned long &bits, double &real)
+{
+	code = BinaryCode(Peek());
+
+	switch(code)
+	{
+	case BinarySigned:
+	case BinaryEnum:
+		Read();
+		if(false == ReadVarint(bits))
+			return false;
+		real = double(UnZigZag(bits));
+		return true;
+	case BinaryUnsigned:
+		Read();
+		if(false == ReadVarint(bits))
+			return false;
+		real = double(bits);
+		return true;
+	case BinaryDouble:
+		{
+			unsigned char buffer[8];
+			unsigned long long value = 0;
+
+			Read();
+
+			if(false == ReadBytes(buffer, sizeof(buffer)))
+				return false;
+
+			for(unsigned i = 0; i < 8; i++)
+			{
+				value |= static_cast<unsigned long long>(buffer[i]) << (i * 8);
+			}
+
+			// bits are left alone, the integer overloads check real's range.
+			std::memcpy(&real, &value, sizeof(real));
+			return true;
+		}
+	case BinaryFalse:
+	case BinaryTrue:
+		Read();
+		bits = code == BinaryTrue;
+		real = double(bits);
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool BinaryDeserializer::Skip()
+{
+	int code = Read();
+	unsigned long value;
+
+	switch(code)
+	{
+	case BinaryObjectTag:
+	case BinaryPropertyTag:
+	case BinaryAttributeTag:
+		if(false == (ReadVarint(value) && SkipBytes(value)))
+			return false;
+		// fall through
+	case BinaryItemTag:
+		while(Peek() != BinaryEnd)
+		{
+			if(false == Skip())
+				return false;
+		}
+		Read();
+		return true;
+
+	case BinaryFalse:
+	case BinaryTrue:
+	case BinaryNull:
+		return true;
+
+	case BinarySigned:
+	case BinaryUnsigned:
+	case BinaryEnum:
+	case BinaryBackReference:
+		return ReadVarint(value);
+
+	case BinaryReference:
+		// keep the indices in step with the serializer.
+		if(ReadVarint(value) && value == mReferenced.size())
+		{
+			mReferenced.push_back(0);
+			return true;
+		}
+		return false;
+
+	case BinaryDouble:
+		return SkipBytes(8);
+
+	case BinaryArray:
+		{
+			int element = ReadVarint(value) ? Read() : -1;
+			unsigned width = element < 0 ? 0 : BinaryArrayWidth(ArrayElement(element));
+			return width && SkipBytes(value * width);
+		}
+
+	case BinaryText:
+	case BinaryData:
+	case BinaryObject:
+		// an object's name is followed by its pointer serialization,
+		// which is skipped as separate tokens.
+		return ReadVarint(value) && SkipBytes(value);
+
+	default:
+		return false;
+	}
+}
+
+bool BinaryDeserializer::Begin(SerializationTag &tag, SerializationTag::TagType type)
+{
+	SerializationTag::TagType found;
+
+	switch(Peek())
+	{
+	case BinaryObjectTag:
+		found = SerializationTag::ObjectTag;
+		break;
+	case BinaryPropertyTag:
+		found = SerializationTag::PropertyTag;
+		break;
+	case BinaryAttributeTag:
+		found = SerializationTag::AttributeTag;
+		break;
+	case BinaryItemTag:
+		found = SerializationTag::ItemTag;
+		break;
+	default:
+		return false;
+	}
+
+	if(type != SerializationTag::UnknownTag && type != found)
+		return false;
+
+	Read();
+
+	tag.Type() = found;
+	tag.Text() = "";
+
+	if(found != SerializationTag::ItemTag)
+	{
+		char buffer[128];
+		unsigned length;
+
+		if(false == ReadName(buffer, sizeof(buffer) - 1, length))
+			return false;
+
+		tag.Text() = string::Fragment(buffer, length);
+	}
+
+	return true;
+}
+
+bool BinaryDeserializer::End(SerializationTag &tag)
+{
+	if(tag.Type() == SerializationTag::UnknownTag)
+		return false;
+
+	// skip anything this reader did not consume.
+	while(Peek() != BinaryEnd)
+	{
+		if(false == Skip())
+			return false;
+	}
+
+	Read();
+
+	return true;
+}
+
+bool BinaryDeserializer::Deserialize(bool &value)
+{
+	BinaryCode code;
+	unsigned long bits;
+	double real;
+
+	if(ReadNumber(code, bits, real))
+	{
+		value = real != 0;
+		return true;
+	}
+
+	return false;
+}
+
+bool BinaryDeserializer::Deserialize(long &value)
+{
+	BinaryCode code;
+	unsigned long bits;
+	double real;
+
+	if(false == ReadNumber(code, bits, real))
+		return false;
+
+	if(code == BinaryDouble)
+	{
+		// also false for NaN.
+		if(false == (real >= double(LONG_MIN) && real < -double(LONG_MIN)))
+			return false;
+
+		value = static_cast<long>(real);
+	}
+	else
+	{
+		value = code == BinarySigned || code == BinaryEnum
+			? UnZigZag(bits)
+			: static_cast<long>(bits);
+	}
+
+	return true;
+
+	return false;
+}
+
+bool BinaryDeserializer::Deserialize(unsigned long &value)
+{
+	BinaryCode code;
+	unsigned long bits;
+	double real;
+
+	if(false == ReadNumber(code, bits, real))
+		return false;
+
+	if(code == BinaryDouble)
+	{
+		// also false for NaN.
+		if(false == (real > -1.0 && real < -2.0 * double(LONG_MIN)))
+			return false;
+
+		value = static_cast<unsigned long>(real);
+	}
+	else
+	{
+		value = code == BinarySigned || code == BinaryEnum
+			? static_cast<unsigned long>(UnZigZag(bits))
+			: bits;
+	}
+
+	return true;
+
+	return false;
+}
+
+bool BinaryDeserializer::Deserialize(double &value)
+{
+	BinaryCode code;
+	unsigned long bits;
+
+	return ReadNumber(code, bits, value);
+}
+
+bool BinaryDeserializer::Deserialize(Dynamic *&object)
+{
+	unsigned long index;
+
+	switch(Peek())
+	{
+	case BinaryNull:
+		Read();
+		object = NULL;
+		return true;
+
+	case BinaryBackReference:
+		Read();
+		if(ReadVarint(index) && index < mReferenced.size())
+		{
+			object = mReferenced[index];
+			return true;
+		}
+
+		object = 0;
+		return false;
+
+	case BinaryObject:
+		{
+			char name[256];
+			unsigned length;
+
+			Read();
+
+			if(ReadName(name, sizeof(name) - 1, length))
+			{
+				if(Class *clazz = mClasses.Find(string::Fragment(name, length)))
+				{
+					Reflector reflector(*this);
+					clazz->DeserializePointer(object, reflector);
+					if(reflector.Ok())
+						return true;
+				}
+			}
+		}
+		break;
+	}
+
+	return false;
+}
+
+bool BinaryDeserializer::Reference(Dynamic *object)
+{
+	if(Peek() != BinaryReference)
+		return false;
+
+	Read();
+
+	unsigned long id;
+
+	if(ReadVarint(id) && id == mReferenced.size())
+	{
+		mReferenced.push_back(object);
+		return true;
+	}
+
+	return false;
+}
+
+bool BinaryDeserializer::DeserializeTextChunk(char *text, unsigned &max_bytes, bool &complete)
+{
+	if(false == mDeserializingText)
+	{
+		if(Peek() != BinaryText)
+			return false; // OK, just no text here.
+
+		Read();
+
+		if(false == ReadVarint(mTextRemaining))
+			return false;
+
+		mDeserializingText = true;
+	}
+
+	unsigned chunk = mTextRemaining < max_bytes ? unsigned(mTextRemaining) : max_bytes;
+
+	if(false == (text ? ReadBytes(text, chunk) : SkipBytes(chunk)))
+		return false; // malformed stream
+
+	mTextRemaining -= chunk;
+	max_bytes = chunk;
+
+	if(0 == mTextRemaining)
+	{
+		complete = true;
+		mDeserializingText = false;
+	}
+
+	return true;
+}
+
+bool BinaryDeserializer::DeserializeTextView(string::Fragment &text)
+{
+	if(mDeserializingText || false == mInput.Resident() || Peek() != BinaryText)
+		return false;
+
+	const unsigned char *begin = reinterpret_cast<const unsigned char *>(mInput.Window());
+	const unsigned char *end = begin + mInput.Available();
+	const unsigned char *cursor = begin + 1;
+	unsigned long size = 0;
+
+	for(unsigned shift = 0; ; shift += 7)
+	{
+		if(cursor == end || shift >= sizeof(unsigned long) * 8)
+			return false;
+
+		size |= static_cast<unsigned long>(*cursor & 0x7F) << shift;
+
+		if(0 == (*cursor++ & 0x80))
+			break;
+	}
+
+	if(size > static_cast<unsigned long>(end - cursor))
+		return false;
+
+	text = string::Fragment(reinterpret_cast<const char *>(cursor), string::Fragment::size_type(size));
+	mInput.Consume(BufferedInputStream::size_type(cursor + size - begin));
+
+	return true;
+}
+
+bool BinaryDeserializer::DeserializeArray(const Type *type, void *data, unsigned count)
+{
+	if(Peek() != BinaryArray)
+		return Deserializer::DeserializeArray(type, data, count);
+
+	ArrayElement element = ArrayElementOf(type);
+	unsigned long stored_count;
+
+	Read();
+
+	if(false == ReadVarint(stored_count) || stored_count != count)
+		return false;
+
+	int stored = Read();
+	unsigned width = stored < 0 ? 0 : BinaryArrayWidth(ArrayElement(stored));
+
+	if(0 == width || NoArrayElement == element)
+		return false;
+
+	if(stored == element && LittleEndian() && width == ArrayElementSize(element))
+		return ReadBytes(data, static_cast<unsigned long>(count) * width);
+
+	unsigned char buffer[1024];
+	unsigned per_read = unsigned(sizeof(buffer)) / width;
+
+	for(unsigned index = 0; index < count; )
+	{
+		unsigned run = count - index < per_read ? count - index : per_read;
+
+		if(false == ReadBytes(buffer, run * width))
+			return false;
+
+		for(unsigned item = 0; item < run; ++item, ++index)
+		{
+			StoreArrayItem(element, data, index,
+				DecodeArrayItem(ArrayElement(stored), buffer + item * width, width));
+		}
+	}
+
+	return true;
+}
+
+bool BinaryDeserializer::DeserializeData(void *data, unsigned nbytes)
+{
+	unsigned long size;
+
+	if(Peek() != BinaryData)
+		return false;
+
+	Read();
+
+	return ReadVarint(size)
+		&& size == nbytes
+		&& ReadBytes(data, nbytes);
+}
+
+bool BinaryDeserializer::DeserializeEnum(int &value, const EnumType *)
+{
+	long number;
+
+	if(Deserialize(number))
+	{
+		value = int(number);
+		return true;
+	}
+
+	return false;
+}
+
+bool BinaryDeserializer::DeserializeProperty(void *object, const Property *prop)
+{
+	Reflector reflector(*this);
+	prop->Serialize(object, object, reflector);
+	return reflector.Ok();
+}
+
+} }
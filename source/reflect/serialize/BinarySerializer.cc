@@ -0,0 +1,267 @@
+#include <reflect/serialize/BinarySerializer.h>
+#include <reflect/SerializationTag.h>
+#include <reflect/Dynamic.h>
+#include <reflect/Reflector.h>
+#include <reflect/Property.h>
+#include <reflect/OutputStream.h>
+#include <reflect/EnumType.h>
+
+#include <cstring>
+
+namespace reflect { namespace serialize {
+
+namespace {
+
+unsigned long ZigZag(long value)
+{
+	return value < 0
+		? ~(static_cast<unsigned long>(value) << 1)
+		: static_cast<unsigned long>(value) << 1;
+}
+
+bool LittleEndian()
+{
+	const unsigned short probe = 1;
+	return 1 == *reinterpret_cast<const unsigned char *>(&probe);
+}
+
+template<typename ItemType>
+unsigned long long IntegerBits(const void *data, unsigned index)
+{
+	// signed items are sign extended, as two's complement.
+	return static_cast<unsigned long long>(static_cast<const ItemType *>(data)[index]);
+}
+
+template<typename ItemType, typename BitsType>
+unsigned long long RealBits(const void *data, unsigned index)
+{
+	BitsType bits;
+	std::memcpy(&bits, static_cast<const ItemType *>(data) + index, sizeof(bits));
+	return bits;
+}
+
+unsigned long long ArrayItemBits(ArrayElement element, const void *data, unsigned index)
+{
+	switch(element)
+	{
+	case BoolElement: return static_cast<const bool *>(data)[index] ? 1 : 0;
+	case CharElement: return IntegerBits<char>(data, index);
+	case SignedCharElement: return IntegerBits<signed char>(data, index);
+	case UnsignedCharElement: return IntegerBits<unsigned char>(data, index);
+	case ShortElement: return IntegerBits<short>(data, index);
+	case UnsignedShortElement: return IntegerBits<unsigned short>(data, index);
+	case IntElement: return IntegerBits<int>(data, index);
+	case UnsignedIntElement: return IntegerBits<unsigned int>(data, index);
+	case LongElement: return IntegerBits<long>(data, index);
+	case UnsignedLongElement: return IntegerBits<unsigned long>(data, index);
+	case FloatElement: return RealBits<float, unsigned int>(data, index);
+	case DoubleElement: return RealBits<double, unsigned long long>(data, index);
+	case NoArrayElement: break;
+	}
+
+	return 0;
+}
+
+}
+
+BinarySerializer::BinarySerializer(OutputStream &stream)
+	: mNextIndex(0)
+	, mStream(stream)
+{
+}
+
+bool BinarySerializer::WriteCode(BinaryCode code)
+{
+	unsigned char byte = static_cast<unsigned char>(code);
+	return mStream.Write(&byte, 1) == 1;
+}
+
+bool BinarySerializer::WriteVarint(BinaryCode code, unsigned long value)
+{
+	unsigned char buffer[2 + sizeof(unsigned long) * 8 / 7];
+	unsigned size = 0;
+
+	buffer[size++] = static_cast<unsigned char>(code);
+
+	while(value >= 0x80)
+	{
+		buffer[size++] = static_cast<unsigned char>(value | 0x80);
+		value >>= 7;
+	}
+
+	buffer[size++] = static_cast<unsigned char>(value);
+
+	return mStream.Write(buffer, size) == OutputStream::size_type(size);
+}
+
+bool BinarySerializer::WriteBlock(BinaryCode code, const void *data, unsigned nbytes)
+{
+	return WriteVarint(code, nbytes)
+		&& (nbytes == 0 || mStream.Write(data, nbytes) == OutputStream::size_type(nbytes));
+}
+
+bool BinarySerializer::Begin(const SerializationTag &tag)
+{
+	string::ConstString text = tag.Text();
+
+	switch(tag.Type())
+	{
+	case SerializationTag::ObjectTag:
+		return WriteBlock(BinaryObjectTag, text.data(), text.size());
+	case SerializationTag::PropertyTag:
+		return WriteBlock(BinaryPropertyTag, text.data(), text.size());
+	case SerializationTag::AttributeTag:
+		return WriteBlock(BinaryAttributeTag, text.data(), text.size());
+	case SerializationTag::ItemTag:
+		return WriteCode(BinaryItemTag);
+	case SerializationTag::UnknownTag:
+		break;
+	}
+
+	return false;
+}
+
+bool BinarySerializer::End(const SerializationTag &tag)
+{
+	if(tag.Type() == SerializationTag::UnknownTag)
+		return false;
+
+	return WriteCode(BinaryEnd);
+}
+
+bool BinarySerializer::Serialize(bool b)
+{
+	return WriteCode(b ? BinaryTrue : BinaryFalse);
+}
+
+bool BinarySerializer::Serialize(long i)
+{
+	return WriteVarint(BinarySigned, ZigZag(i));
+}
+
+bool BinarySerializer::Serialize(unsigned long i)
+{
+	return WriteVarint(BinaryUnsigned, i);
+}
+
+bool BinarySerializer::Serialize(double d)
+{
+	unsigned long long bits;
+	unsigned char buffer[9];
+
+	std::memcpy(&bits, &d, sizeof(bits));
+
+	buffer[0] = static_cast<unsigned char>(BinaryDouble);
+
+	for(unsigned i = 0; i < 8; i++)
+	{
+		buffer[i + 1] = static_cast<unsigned char>(bits >> (i * 8));
+	}
+
+	return mStream.Write(buffer, sizeof(buffer)) == OutputStream::size_type(sizeof(buffer));
+}
+
+bool BinarySerializer::SerializeArray(const Type *type, const void *data, unsigned count)
+{
+	ArrayElement element = ArrayElementOf(type);
+	unsigned width = BinaryArrayWidth(element);
+	unsigned char code = static_cast<unsigned char>(element);
+
+	if(0 == width
+	|| false == WriteVarint(BinaryArray, count)
+	|| mStream.Write(&code, 1) != 1)
+	{
+		return false;
+	}
+
+	if(LittleEndian() && width == ArrayElementSize(element))
+	{
+		OutputStream::size_type nbytes = OutputStream::size_type(count) * width;
+		return mStream.Write(data, nbytes) == nbytes;
+	}
+
+	unsigned char buffer[1024];
+	unsigned size = 0;
+
+	for(unsigned index = 0; index < count; ++index)
+	{
+		unsigned long long bits = ArrayItemBits(element, data, index);
+
+		for(unsigned byte = 0; byte < width; byte++)
+		{
+			buffer[size++] = static_cast<unsigned char>(bits >> (byte * 8));
+		}
+
+		if(size + width > sizeof(buffer) || index + 1 == count)
+		{
+			if(mStream.Write(buffer, size) != OutputStream::size_type(size))
+				return false;
+
+			size = 0;
+		}
+	}
+
+	return true;
+}
+
+bool BinarySerializer::Serialize(const Dynamic *object)
+{
+	if(0 == object)
+	{
+		return WriteCode(BinaryNull);
+	}
+
+	if(const int *ref = mReferenced.Find(object))
+	{
+		return WriteVarint(BinaryBackReference, *ref);
+	}
+
+	const Class *serialization_class = object->GetClass()->SerializesAs();
+	const char *name = serialization_class->Name();
+
+	bool result = WriteBlock(BinaryObject, name, std::strlen(name));
+
+	Reflector reflector(*this);
+	serialization_class->SerializePointer(object, reflector);
+
+	return result && reflector.Ok();
+}
+
+bool BinarySerializer::Reference(const Dynamic *object)
+{
+	if(mReferenced.Insert(object, mNextIndex))
+	{
+		return WriteVarint(BinaryReference, mNextIndex++);
+	}
+
+	return false;
+}
+
+void BinarySerializer::Reserve(unsigned objects)
+{
+	mReferenced.Reserve(objects);
+}
+
+bool BinarySerializer::SerializeText(const char *text, unsigned nbytes)
+{
+	return WriteBlock(BinaryText, text, nbytes);
+}
+
+bool BinarySerializer::SerializeData(const void *data, unsigned nbytes)
+{
+	return WriteBlock(BinaryData, data, nbytes);
+}
+
+bool BinarySerializer::SerializeEnum(int value, const EnumType *)
+{
+	return WriteVarint(BinaryEnum, ZigZag(value));
+}
+
+bool BinarySerializer::SerializeProperty(const void *object, const Property *prop)
+{
+	Reflector reflector(*this);
+	prop->Serialize(object, 0, reflector);
+	return reflector.Ok();
+}
+
+} }
@@ -0,0 +1,62 @@
+#include <reflect/serialize/ClassCache.h>
+#include <reflect/Class.h>
+#include <reflect/autocast.h>
+
+namespace reflect { namespace serialize {
+
+ClassCache::ClassCache()
+	: mEntries(8)
+	, mSize(0)
+{
+}
+
+Class *ClassCache::Find(const string::Fragment &name)
+{
+	unsigned hash = Type::HashName(name);
+	std::size_t mask = mEntries.size() - 1;
+	std::size_t index = hash & mask;
+
+	for(; mEntries[index].used; index = (index + 1) & mask)
+	{
+		Entry &entry = mEntries[index];
+
+		if(entry.hash == hash && string::Fragment(entry.name) == name)
+			return entry.clazz;
+	}
+
+	Class *clazz = Type::FindType(name, hash) % autocast;
+
+	Entry &entry = mEntries[index];
+	entry.hash = hash;
+	entry.name = name;
+	entry.clazz = clazz;
+	entry.used = true;
+
+	if(2 * ++mSize > mEntries.size())
+		Grow();
+
+	return clazz;
+}
+
+void ClassCache::Grow()
+{
+	std::vector<Entry> entries(mEntries.size() * 2);
+	std::size_t mask = entries.size() - 1;
+
+	for(std::size_t each = 0; each < mEntries.size(); ++each)
+	{
+		if(mEntries[each].used)
+		{
+			std::size_t index = mEntries[each].hash & mask;
+
+			while(entries[index].used)
+				index = (index + 1) & mask;
+
+			entries[index] = mEntries[each];
+		}
+	}
+
+	mEntries.swap(entries);
+}
+
+} }
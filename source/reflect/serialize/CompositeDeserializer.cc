@@ -36,12 +36,18 @@ bool CompositeDeserializer::Reference(Dynamic *object)
 bool CompositeDeserializer::DeserializeTextChunk(char *text, unsigned &max_bytes, bool &complete)
 { return mDeserializer.DeserializeTextChunk(text, max_bytes, complete); }
 
+bool CompositeDeserializer::DeserializeTextView(string::Fragment &text)
+{ return mDeserializer.DeserializeTextView(text); }
+
 bool CompositeDeserializer::DeserializeData(void *data, unsigned nbytes)
 { return mDeserializer.DeserializeData(data, nbytes); }
 
 bool CompositeDeserializer::DeserializeEnum(int &value, const EnumType *clazz)
 { return mDeserializer.DeserializeEnum(value, clazz); }
 
+bool CompositeDeserializer::DeserializeArray(const Type *type, void *data, unsigned count)
+{ return mDeserializer.DeserializeArray(type, data, count); }
+
 
 bool CompositeDeserializer::DeserializeProperty(void *object, const Property *prop)
 { 
@@ -33,6 +33,9 @@ bool CompositeSerializer::Serialize(const Dynamic *object)
 bool CompositeSerializer::Reference(const Dynamic *object)
 { return mSerializer.Reference(object); }
 
+void CompositeSerializer::Reserve(unsigned objects)
+{ mSerializer.Reserve(objects); }
+
 bool CompositeSerializer::SerializeText(const char *text, unsigned nbytes)
 { return mSerializer.SerializeText(text, nbytes); }
 
@@ -42,6 +45,9 @@ bool CompositeSerializer::SerializeData(const void *data, unsigned nbytes)
 bool CompositeSerializer::SerializeEnum(int value, const EnumType *clazz)
 { return mSerializer.SerializeEnum(value, clazz); }
 
+bool CompositeSerializer::SerializeArray(const Type *type, const void *data, unsigned count)
+{ return mSerializer.SerializeArray(type, data, count); }
+
 bool CompositeSerializer::SerializeProperty(const void *object, const Property *prop)
 { 
 	Reflector reflector(*this);
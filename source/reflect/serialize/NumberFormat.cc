@@ -0,0 +1,678 @@
+#include <reflect/serialize/NumberFormat.h>
+
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace reflect { namespace serialize {
+
+namespace {
+
+const char sDigitPairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+const char sHexDigits[] = "0123456789ABCDEF";
+
+// powers of ten which are exact as doubles.
+const double sExactPowers[] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+	1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+	1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+const int sMaxExactPower = int(sizeof(sExactPowers) / sizeof(sExactPowers[0])) - 1;
+
+// writes the digits of value backwards from end, returns the first digit.
+char *FormatDigits(char *end, unsigned long value)
+{
+	while(value >= 100)
+	{
+		unsigned pair = unsigned(value % 100) * 2;
+		value /= 100;
+		*--end = sDigitPairs[pair + 1];
+		*--end = sDigitPairs[pair];
+	}
+
+	if(value >= 10)
+	{
+		unsigned pair = unsigned(value) * 2;
+		*--end = sDigitPairs[pair + 1];
+		*--end = sDigitPairs[pair];
+	}
+	else
+	{
+		*--end = char('0' + value);
+	}
+
+	return end;
+}
+
+unsigned CopyDigits(char *buffer, bool negative, unsigned long magnitude)
+{
+	char digits[MaxNumberLength];
+	char *end = digits + sizeof(digits);
+	char *begin = FormatDigits(end, magnitude);
+
+	if(negative)
+		*--begin = '-';
+
+	std::memcpy(buffer, begin, end - begin);
+
+	return unsigned(end - begin);
+}
+
+typedef unsigned long long Bits;
+
+// Struct: DiyFp
+// A 64 bit significand and binary exponent, f * 2^e.
+struct DiyFp
+{
+	DiyFp(Bits significand = 0, int exponent = 0)
+		: f(significand)
+		, e(exponent)
+	{
+	}
+
+	Bits f;
+	int e;
+};
+
+// the product's upper 64 bits, rounded.
+DiyFp Multiply(const DiyFp &x, const DiyFp &y)
+{
+	const Bits low_mask = 0xFFFFFFFFull;
+	Bits a = x.f >> 32, b = x.f & low_mask;
+	Bits c = y.f >> 32, d = y.f & low_mask;
+	Bits ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+	Bits middle = (bd >> 32) + (ad & low_mask) + (bc & low_mask) + (1ull << 31);
+
+	return DiyFp(ac + (ad >> 32) + (bc >> 32) + (middle >> 32), x.e + y.e + 64);
+}
+
+DiyFp Normalize(DiyFp x)
+{
+	while(0 == (x.f & 0xFFC0000000000000ull))
+	{
+		x.f <<= 10;
+		x.e -= 10;
+	}
+
+	while(0 == (x.f & 0x8000000000000000ull))
+	{
+		x.f <<= 1;
+		x.e -= 1;
+	}
+
+	return x;
+}
+
+struct CachedPower
+{
+	Bits significand;
+	short binary_exponent;
+	short decimal_exponent;
+};
+
+// 10^-348 to 10^340 in steps of 8, as normalized significands rounded to 64 bits.
+const CachedPower sCachedPowers[] = {
+	{ 0xFA8FD5A0081C0288ull, -1220, -348 },
+	{ 0xBAAEE17FA23EBF76ull, -1193, -340 },
+	{ 0x8B16FB203055AC76ull, -1166, -332 },
+	{ 0xCF42894A5DCE35EAull, -1140, -324 },
+	{ 0x9A6BB0AA55653B2Dull, -1113, -316 },
+	{ 0xE61ACF033D1A45DFull, -1087, -308 },
+	{ 0xAB70FE17C79AC6CAull, -1060, -300 },
+	{ 0xFF77B1FCBEBCDC4Full, -1034, -292 },
+	{ 0xBE5691EF416BD60Cull, -1007, -284 },
+	{ 0x8DD01FAD907FFC3Cull, -980, -276 },
+	{ 0xD3515C2831559A83ull, -954, -268 },
+	{ 0x9D71AC8FADA6C9B5ull, -927, -260 },
+	{ 0xEA9C227723EE8BCBull, -901, -252 },
+	{ 0xAECC49914078536Dull, -874, -244 },
+	{ 0x823C12795DB6CE57ull, -847, -236 },
+	{ 0xC21094364DFB5637ull, -821, -228 },
+	{ 0x9096EA6F3848984Full, -794, -220 },
+	{ 0xD77485CB25823AC7ull, -768, -212 },
+	{ 0xA086CFCD97BF97F4ull, -741, -204 },
+	{ 0xEF340A98172AACE5ull, -715, -196 },
+	{ 0xB23867FB2A35B28Eull, -688, -188 },
+	{ 0x84C8D4DFD2C63F3Bull, -661, -180 },
+	{ 0xC5DD44271AD3CDBAull, -635, -172 },
+	{ 0x936B9FCEBB25C996ull, -608, -164 },
+	{ 0xDBAC6C247D62A584ull, -582, -156 },
+	{ 0xA3AB66580D5FDAF6ull, -555, -148 },
+	{ 0xF3E2F893DEC3F126ull, -529, -140 },
+	{ 0xB5B5ADA8AAFF80B8ull, -502, -132 },
+	{ 0x87625F056C7C4A8Bull, -475, -124 },
+	{ 0xC9BCFF6034C13053ull, -449, -116 },
+	{ 0x964E858C91BA2655ull, -422, -108 },
+	{ 0xDFF9772470297EBDull, -396, -100 },
+	{ 0xA6DFBD9FB8E5B88Full, -369, -92 },
+	{ 0xF8A95FCF88747D94ull, -343, -84 },
+	{ 0xB94470938FA89BCFull, -316, -76 },
+	{ 0x8A08F0F8BF0F156Bull, -289, -68 },
+	{ 0xCDB02555653131B6ull, -263, -60 },
+	{ 0x993FE2C6D07B7FACull, -236, -52 },
+	{ 0xE45C10C42A2B3B06ull, -210, -44 },
+	{ 0xAA242499697392D3ull, -183, -36 },
+	{ 0xFD87B5F28300CA0Eull, -157, -28 },
+	{ 0xBCE5086492111AEBull, -130, -20 },
+	{ 0x8CBCCC096F5088CCull, -103, -12 },
+	{ 0xD1B71758E219652Cull, -77, -4 },
+	{ 0x9C40000000000000ull, -50, 4 },
+	{ 0xE8D4A51000000000ull, -24, 12 },
+	{ 0xAD78EBC5AC620000ull, 3, 20 },
+	{ 0x813F3978F8940984ull, 30, 28 },
+	{ 0xC097CE7BC90715B3ull, 56, 36 },
+	{ 0x8F7E32CE7BEA5C70ull, 83, 44 },
+	{ 0xD5D238A4ABE98068ull, 109, 52 },
+	{ 0x9F4F2726179A2245ull, 136, 60 },
+	{ 0xED63A231D4C4FB27ull, 162, 68 },
+	{ 0xB0DE65388CC8ADA8ull, 189, 76 },
+	{ 0x83C7088E1AAB65DBull, 216, 84 },
+	{ 0xC45D1DF942711D9Aull, 242, 92 },
+	{ 0x924D692CA61BE758ull, 269, 100 },
+	{ 0xDA01EE641A708DEAull, 295, 108 },
+	{ 0xA26DA3999AEF774Aull, 322, 116 },
+	{ 0xF209787BB47D6B85ull, 348, 124 },
+	{ 0xB454E4A179DD1877ull, 375, 132 },
+	{ 0x865B86925B9BC5C2ull, 402, 140 },
+	{ 0xC83553C5C8965D3Dull, 428, 148 },
+	{ 0x952AB45CFA97A0B3ull, 455, 156 },
+	{ 0xDE469FBD99A05FE3ull, 481, 164 },
+	{ 0xA59BC234DB398C25ull, 508, 172 },
+	{ 0xF6C69A72A3989F5Cull, 534, 180 },
+	{ 0xB7DCBF5354E9BECEull, 561, 188 },
+	{ 0x88FCF317F22241E2ull, 588, 196 },
+	{ 0xCC20CE9BD35C78A5ull, 614, 204 },
+	{ 0x98165AF37B2153DFull, 641, 212 },
+	{ 0xE2A0B5DC971F303Aull, 667, 220 },
+	{ 0xA8D9D1535CE3B396ull, 694, 228 },
+	{ 0xFB9B7CD9A4A7443Cull, 720, 236 },
+	{ 0xBB764C4CA7A44410ull, 747, 244 },
+	{ 0x8BAB8EEFB6409C1Aull, 774, 252 },
+	{ 0xD01FEF10A657842Cull, 800, 260 },
+	{ 0x9B10A4E5E9913129ull, 827, 268 },
+	{ 0xE7109BFBA19C0C9Dull, 853, 276 },
+	{ 0xAC2820D9623BF429ull, 880, 284 },
+	{ 0x80444B5E7AA7CF85ull, 907, 292 },
+	{ 0xBF21E44003ACDD2Dull, 933, 300 },
+	{ 0x8E679C2F5E44FF8Full, 960, 308 },
+	{ 0xD433179D9C8CB841ull, 986, 316 },
+	{ 0x9E19DB92B4E31BA9ull, 1013, 324 },
+	{ 0xEB96BF6EBADF77D9ull, 1039, 332 },
+	{ 0xAF87023B9BF0EE6Bull, 1066, 340 }
+};
+
+const int sCachedPowersOffset = 348;
+const int sCachedPowersStep = 8;
+
+// Grisu3 trims the last digit towards the value, and gives up
+// when the digits might not be the closest or shortest.
+bool RoundWeed(char *digits, int length, Bits distance_too_high_w, Bits unsafe_interval, Bits rest, Bits ten_kappa, Bits unit)
+{
+	Bits small_distance = distance_too_high_w - unit;
+	Bits big_distance = distance_too_high_w + unit;
+
+	while(rest < small_distance
+	&& unsafe_interval - rest >= ten_kappa
+	&& (rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance))
+	{
+		digits[length - 1]--;
+		rest += ten_kappa;
+	}
+
+	if(rest < big_distance
+	&& unsafe_interval - rest >= ten_kappa
+	&& (rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance))
+	{
+		return false;
+	}
+
+	return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+// generates the digits of w, as few as will stay strictly between low and high.
+bool GenerateDigits(const DiyFp &low, const DiyFp &w, const DiyFp &high, char *digits, int &length, int &kappa)
+{
+	Bits unit = 1;
+	DiyFp too_low(low.f - unit, low.e);
+	DiyFp too_high(high.f + unit, high.e);
+	Bits unsafe_interval = too_high.f - too_low.f;
+	const int shift = -w.e;
+	const Bits one = 1ull << shift;
+	unsigned integrals = unsigned(too_high.f >> shift);
+	Bits fractionals = too_high.f & (one - 1);
+	unsigned divisor = 1000000000;
+
+	for(kappa = 10; kappa > 0 && integrals < divisor; kappa--)
+		divisor /= 10;
+
+	length = 0;
+
+	while(kappa > 0)
+	{
+		digits[length++] = char('0' + integrals / divisor);
+		integrals %= divisor;
+		kappa--;
+
+		Bits rest = (Bits(integrals) << shift) + fractionals;
+
+		if(rest < unsafe_interval)
+			return RoundWeed(digits, length, too_high.f - w.f, unsafe_interval, rest, Bits(divisor) << shift, unit);
+
+		divisor /= 10;
+	}
+
+	for(;;)
+	{
+		fractionals *= 10;
+		unit *= 10;
+		unsafe_interval *= 10;
+		digits[length++] = char('0' + (fractionals >> shift));
+		fractionals &= one - 1;
+		kappa--;
+
+		if(fractionals < unsafe_interval)
+			return RoundWeed(digits, length, (too_high.f - w.f) * unit, unsafe_interval, fractionals, one, unit);
+	}
+}
+
+// Grisu3 (Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+// with Integers"): the shortest digits which read back as the positive,
+// finite *value*, which is digits * 10^exponent.  Returns false for the
+// few values (about 0.5%) it can't prove the result is shortest for.
+bool ShortestDigits(double value, char *digits, int &length, int &exponent)
+{
+	const Bits hidden = 1ull << 52;
+	Bits bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	Bits fraction = bits & (hidden - 1);
+	int biased = int(bits >> 52) & 0x7FF;
+	DiyFp v = biased ? DiyFp(fraction | hidden, biased - 1075) : DiyFp(fraction, -1074);
+
+	// halfway to the neighbouring doubles, the one below is closer above a power of two.
+	DiyFp plus = Normalize(DiyFp((v.f << 1) + 1, v.e - 1));
+	DiyFp minus = (0 == fraction && biased > 1)
+		? DiyFp((v.f << 2) - 1, v.e - 2)
+		: DiyFp((v.f << 1) - 1, v.e - 1);
+	minus.f <<= minus.e - plus.e;
+	minus.e = plus.e;
+	DiyFp w = Normalize(v);
+
+	// a power of ten which scales w's exponent into [-60, -32].
+	int k = int(std::ceil((-60 - (w.e + 64) + 63) * 0.30102999566398114));
+	const CachedPower &power = sCachedPowers[(sCachedPowersOffset + k - 1) / sCachedPowersStep + 1];
+	DiyFp ten(power.significand, power.binary_exponent);
+
+	int kappa;
+
+	if(false == GenerateDigits(Multiply(minus, ten), Multiply(w, ten), Multiply(plus, ten), digits, length, kappa))
+		return false;
+
+	exponent = kappa - power.decimal_exponent;
+	return true;
+}
+
+// lays out digits * 10^exponent as printf's "%.*g" would
+// with the precision of the digits, but at least 15.
+unsigned WriteDecimal(char *buffer, bool negative, const char *digits, int length, int exponent)
+{
+	char *cursor = buffer;
+	int point = length + exponent;
+	int precision = length > 15 ? length : 15;
+
+	if(negative)
+		*cursor++ = '-';
+
+	if(point - 1 < -4 || point - 1 >= precision)
+	{
+		*cursor++ = digits[0];
+
+		if(length > 1)
+		{
+			*cursor++ = '.';
+			std::memcpy(cursor, digits + 1, length - 1);
+			cursor += length - 1;
+		}
+
+		int scientific = point - 1;
+		*cursor++ = 'e';
+		*cursor++ = scientific < 0 ? '-' : '+';
+		scientific = scientific < 0 ? -scientific : scientific;
+
+		if(scientific < 10)
+			*cursor++ = '0';
+
+		cursor += CopyDigits(cursor, false, static_cast<unsigned long>(scientific));
+	}
+	else if(point <= 0)
+	{
+		*cursor++ = '0';
+		*cursor++ = '.';
+		std::memset(cursor, '0', -point);
+		cursor += -point;
+		std::memcpy(cursor, digits, length);
+		cursor += length;
+	}
+	else if(point >= length)
+	{
+		std::memcpy(cursor, digits, length);
+		cursor += length;
+		std::memset(cursor, '0', point - length);
+		cursor += point - length;
+	}
+	else
+	{
+		std::memcpy(cursor, digits, point);
+		cursor += point;
+		*cursor++ = '.';
+		std::memcpy(cursor, digits + point, length - point);
+		cursor += length - point;
+	}
+
+	return unsigned(cursor - buffer);
+}
+
+// parses plain decimal or 0x-prefixed hex digits, without overflow.
+// anything else (octal, overflow, junk) is left to the C library.
+bool ParseDigits(const char *cursor, const char *end, unsigned long &value)
+{
+	unsigned long result = 0;
+
+	if(cursor == end)
+		return false;
+
+	if(end - cursor > 2 && cursor[0] == '0' && (cursor[1] | 0x20) == 'x')
+	{
+		for(cursor += 2; cursor != end; ++cursor)
+		{
+			unsigned digit = unsigned(*cursor - '0');
+
+			if(digit >= 10)
+			{
+				digit = unsigned((*cursor | 0x20) - 'a');
+
+				if(digit >= 6)
+					return false;
+
+				digit += 10;
+			}
+
+			if(result > (ULONG_MAX >> 4))
+				return false;
+
+			result = (result << 4) | digit;
+		}
+	}
+	else if(cursor[0] == '0' && end - cursor > 1)
+	{
+		return false; // octal
+	}
+	else for(; cursor != end; ++cursor)
+	{
+		unsigned digit = unsigned(*cursor - '0');
+
+		if(digit >= 10 || result > (ULONG_MAX - digit) / 10)
+			return false;
+
+		result = result * 10 + digit;
+	}
+
+	value = result;
+
+	return true;
+}
+
+// strtol, strtoul and strtod need a terminated string.
+class Terminated
+{
+public:
+	Terminated(const char *text, unsigned size)
+		: mOk(size < sizeof(mBuffer))
+	{
+		if(mOk)
+		{
+			std::memcpy(mBuffer, text, size);
+			mBuffer[size] = '\0';
+		}
+	}
+
+	const char *c_str() const { return mOk ? mBuffer : 0; }
+	bool AtEnd(const char *endp, unsigned size) const { return mOk && size && endp == mBuffer + size; }
+
+private:
+	bool mOk;
+	char mBuffer[64];
+};
+
+}
+
+unsigned FormatSigned(char *buffer, long value)
+{
+	unsigned long magnitude = value < 0
+		? 0ul - static_cast<unsigned long>(value)
+		: static_cast<unsigned long>(value);
+
+	return CopyDigits(buffer, value < 0, magnitude);
+}
+
+unsigned FormatHex(char *buffer, unsigned long value)
+{
+	char digits[MaxNumberLength];
+	char *end = digits + sizeof(digits);
+	char *begin = end;
+
+	do
+	{
+		*--begin = sHexDigits[value & 0xF];
+		value >>= 4;
+	}
+	while(value);
+
+	*--begin = 'x';
+	*--begin = '0';
+
+	std::memcpy(buffer, begin, end - begin);
+
+	return unsigned(end - begin);
+}
+
+unsigned FormatDouble(char *buffer, double value)
+{
+	// integers print exactly, as "%.15g" would print them.
+	if(value != 0 && value > -1e15 && value < 1e15
+	&& value >= double(LONG_MIN) && value <= double(LONG_MAX)
+	&& value == double(long(value)))
+	{
+		return FormatSigned(buffer, long(value));
+	}
+
+	Bits bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	bool negative = 0 != (bits >> 63);
+
+	if(value == 0)
+	{
+		unsigned size = 0;
+
+		if(negative)
+			buffer[size++] = '-';
+
+		buffer[size++] = '0';
+		return size;
+	}
+
+	char digits[20];
+	int length, exponent;
+
+	if(value - value == 0 && ShortestDigits(negative ? -value : value, digits, length, exponent))
+		return WriteDecimal(buffer, negative, digits, length, exponent);
+
+	// infinities, NaNs and the values Grisu3 gives up on.  Any decimal of
+	// 15 or fewer digits survives a round trip through a double,
+	// so the first precision which reads back is the shortest.
+	for(int precision = 15; ; ++precision)
+	{
+		int size = std::sprintf(buffer, "%.*g", precision, value);
+		double check;
+
+		if(precision == 17 || (ParseDouble(buffer, unsigned(size), check) && check == value))
+			return unsigned(size);
+	}
+}
+
+bool ParseSigned(const char *text, unsigned size, long &value)
+{
+	const char *cursor = text;
+	const char *end = text + size;
+	bool negative = false;
+
+	if(cursor != end && (*cursor == '-' || *cursor == '+'))
+		negative = *cursor++ == '-';
+
+	unsigned long magnitude;
+
+	if(ParseDigits(cursor, end, magnitude))
+	{
+		if(negative && magnitude - 1 <= static_cast<unsigned long>(LONG_MAX))
+		{
+			value = -long(magnitude - 1) - 1;
+			return true;
+		}
+		else if(!negative && magnitude <= static_cast<unsigned long>(LONG_MAX))
+		{
+			value = long(magnitude);
+			return true;
+		}
+	}
+
+	Terminated terminated(text, size);
+	char *endp = 0;
+
+	if(terminated.c_str())
+		value = std::strtol(terminated.c_str(), &endp, 0);
+
+	return terminated.AtEnd(endp, size);
+}
+
+bool ParseUnsigned(const char *text, unsigned size, unsigned long &value)
+{
+	if(ParseDigits(text, text + size, value))
+		return true;
+
+	Terminated terminated(text, size);
+	char *endp = 0;
+
+	if(terminated.c_str())
+		value = std::strtoul(terminated.c_str(), &endp, 0);
+
+	return terminated.AtEnd(endp, size);
+}
+
+bool ParseDouble(const char *text, unsigned size, double &value)
+{
+	const char *cursor = text;
+	const char *end = text + size;
+	bool negative = false;
+
+	if(cursor != end && (*cursor == '-' || *cursor == '+'))
+		negative = *cursor++ == '-';
+
+	// accumulate up to 15 significant digits, which are exact in a double.
+	double mantissa = 0;
+	int significant = 0;
+	int exponent = 0;
+	bool digits = false;
+	bool exact = true;
+
+	for(; cursor != end && unsigned(*cursor - '0') < 10; ++cursor)
+	{
+		digits = true;
+
+		if(mantissa != 0 || *cursor != '0')
+		{
+			exact = exact && ++significant <= 15;
+			mantissa = mantissa * 10 + (*cursor - '0');
+		}
+	}
+
+	if(cursor != end && *cursor == '.')
+	{
+		for(++cursor; cursor != end && unsigned(*cursor - '0') < 10; ++cursor)
+		{
+			digits = true;
+
+			if(mantissa != 0 || *cursor != '0')
+			{
+				exact = exact && ++significant <= 15;
+				mantissa = mantissa * 10 + (*cursor - '0');
+			}
+
+			exponent--;
+		}
+	}
+
+	if(digits && cursor != end && (*cursor | 0x20) == 'e')
+	{
+		bool negative_exponent = false;
+		int written = 0;
+		const char *first = ++cursor;
+
+		if(cursor != end && (*cursor == '-' || *cursor == '+'))
+			negative_exponent = *cursor++ == '-';
+
+		for(first = cursor; cursor != end && unsigned(*cursor - '0') < 10; ++cursor)
+		{
+			if(written < 10000)
+				written = written * 10 + (*cursor - '0');
+		}
+
+		digits = cursor != first;
+		exponent += negative_exponent ? -written : written;
+	}
+
+	// Clinger's fast path: both operands are exact, so the one rounding is correct.
+	if(digits && exact && cursor == end)
+	{
+		if(mantissa == 0)
+		{
+			value = negative ? -0.0 : 0.0;
+			return true;
+		}
+		else if(exponent >= 0 && exponent <= sMaxExactPower)
+		{
+			value = mantissa * sExactPowers[exponent];
+			value = negative ? -value : value;
+			return true;
+		}
+		else if(exponent < 0 && -exponent <= sMaxExactPower)
+		{
+			value = mantissa / sExactPowers[-exponent];
+			value = negative ? -value : value;
+			return true;
+		}
+	}
+
+	Terminated terminated(text, size);
+	char *endp = 0;
+
+	if(terminated.c_str())
+		value = std::strtod(terminated.c_str(), &endp);
+
+	return terminated.AtEnd(endp, size);
+}
+
+} }
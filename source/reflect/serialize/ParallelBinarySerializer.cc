@@ -0,0 +1,316 @@
+#include <reflect/serialize/ParallelBinarySerializer.h>
+#include <reflect/serialize/BinarySerializer.h>
+#include <reflect/string/StringOutputStream.h>
+#include <reflect/string/StringPool.h>
+#include <reflect/utility/PointerMap.hpp>
+#include <reflect/utility/Thread.h>
+#include <reflect/utility/Mutex.h>
+#include <reflect/OutputStream.h>
+#include <reflect/Dynamic.h>
+
+namespace reflect { namespace serialize {
+
+namespace {
+
+typedef OutputStream::size_type Offset;
+
+// Struct: Event
+// An object or back reference written by a <Partition>.
+struct Event
+{
+	Event(Offset at, const Dynamic *obj, bool back_reference)
+		: begin(at)
+		, end(at)
+		, reference_begin(at)
+		, reference_end(at)
+		, object(obj)
+		, index(-1)
+		, skip(0)
+		, back(back_reference)
+	{
+	}
+
+	// the bytes of the object or back reference.
+	Offset begin, end;
+
+	// the object's <BinaryReference>, if it was referenced.
+	Offset reference_begin, reference_end;
+
+	const Dynamic *object;
+
+	// the partition's reference index of the object or back reference.
+	int index;
+
+	// the event after the object and everything inside it.
+	std::size_t skip;
+
+	bool back;
+};
+
+struct PartitionBuffer
+{
+	string::StringOutputStream buffer;
+};
+
+// Class: Partition
+// Serializes one root to a buffer, noting where each object
+// and reference was written so they can be renumbered.
+class Partition
+	: private PartitionBuffer
+	, public BinarySerializer
+{
+public:
+	Partition(const Dynamic *root)
+		: BinarySerializer(buffer)
+		, mRoot(root)
+		, mOk(false)
+	{
+	}
+
+	void Run()
+	{
+		Serializer &serializer = *this;
+		mOk = serializer.Serialize(mRoot);
+	}
+
+	bool Ok() const { return mOk; }
+	const string::String &Data() { return buffer.Result(); }
+	const std::vector<Event> &Events() const { return mEvents; }
+	const Dynamic *Object(int index) const { return mObjects[index]; }
+
+protected:
+	using BinarySerializer::Serialize;
+
+	bool Serialize(const Dynamic *object) /*virtual*/
+	{
+		if(0 == object)
+			return BinarySerializer::Serialize(object);
+
+		if(const int *index = mIndices.Find(object))
+		{
+			Event event(Offset(Data().size()), object, true);
+			event.index = *index;
+
+			bool result = BinarySerializer::Serialize(object);
+
+			event.end = Offset(Data().size());
+			event.skip = mEvents.size() + 1;
+			mEvents.push_back(event);
+			return result;
+		}
+
+		std::size_t position = mEvents.size();
+		mEvents.push_back(Event(Offset(Data().size()), object, false));
+		mOpen.push_back(position);
+
+		bool result = BinarySerializer::Serialize(object);
+
+		mOpen.pop_back();
+		mEvents[position].end = Offset(Data().size());
+		mEvents[position].skip = mEvents.size();
+		return result;
+	}
+
+	bool Reference(const Dynamic *object) /*virtual*/
+	{
+		Offset begin = Offset(Data().size());
+
+		if(false == BinarySerializer::Reference(object))
+			return false;
+
+		int index = int(mObjects.size());
+		mObjects.push_back(object);
+		mIndices.Insert(object, index);
+
+		if(mOpen.size() && mEvents[mOpen.back()].object == object)
+		{
+			Event &event = mEvents[mOpen.back()];
+			event.index = index;
+			event.reference_begin = begin;
+			event.reference_end = Offset(Data().size());
+		}
+
+		return true;
+	}
+
+private:
+	const Dynamic *mRoot;
+	bool mOk;
+	std::vector<Event> mEvents;
+	std::vector<std::size_t> mOpen;
+	std::vector<const Dynamic *> mObjects;
+	utility::PointerMap<int> mIndices;
+};
+
+// Class: Stitcher
+// Copies partitions to the output, renumbering references
+// in the order they are written.
+class Stitcher : public BinarySerializer
+{
+public:
+	Stitcher(OutputStream &stream)
+		: BinarySerializer(stream)
+		, mOutput(stream)
+		, mNextIndex(0)
+	{
+	}
+
+	bool Write(Partition &partition)
+	{
+		const string::String &data = partition.Data();
+		const std::vector<Event> &events = partition.Events();
+		Offset position = 0;
+
+		for(std::size_t next = 0; next < events.size(); )
+		{
+			const Event &event = events[next];
+
+			if(false == Copy(data, position, event.begin))
+				return false;
+
+			if(event.back)
+			{
+				const int *index = mIndices.Find(partition.Object(event.index));
+
+				if(0 == index || false == WriteVarint(BinaryBackReference, *index))
+					return false;
+
+				position = event.end;
+				next++;
+			}
+			else if(event.index < 0)
+			{
+				// never referenced, nothing to renumber.
+				position = event.begin;
+				next++;
+			}
+			else if(const int *index = mIndices.Find(event.object))
+			{
+				// written by an earlier partition, along with everything inside it.
+				if(false == WriteVarint(BinaryBackReference, *index))
+					return false;
+
+				position = event.end;
+				next = event.skip;
+			}
+			else
+			{
+				if(false == Copy(data, event.begin, event.reference_begin)
+				|| false == WriteVarint(BinaryReference, mNextIndex))
+					return false;
+
+				mIndices.Insert(event.object, mNextIndex++);
+				position = event.reference_end;
+				next++;
+			}
+		}
+
+		return Copy(data, position, Offset(data.size()));
+	}
+
+private:
+	bool Copy(const string::String &data, Offset begin, Offset end)
+	{
+		return begin >= end
+			|| mOutput.Write(data.data() + begin, end - begin) == end - begin;
+	}
+
+	OutputStream &mOutput;
+	int mNextIndex;
+	utility::PointerMap<int> mIndices;
+};
+
+struct WorkQueue
+{
+	WorkQueue(std::vector<Partition *> &partitions)
+		: context(string::StringPoolContext::GetContext())
+		, partitions(partitions)
+		, next(0)
+	{
+	}
+
+	string::StringPoolContext *context;
+	std::vector<Partition *> &partitions;
+	std::size_t next;
+	utility::Mutex mutex;
+};
+
+void Work(void *data)
+{
+	WorkQueue &queue = *static_cast<WorkQueue *>(data);
+	string::StringPoolContext::Inherit inherit(queue.context);
+
+	for(;;)
+	{
+		Partition *partition = 0;
+
+		{
+			utility::ScopedLock lock(queue.mutex);
+
+			if(queue.next < queue.partitions.size())
+				partition = queue.partitions[queue.next++];
+		}
+
+		if(0 == partition)
+			break;
+
+		partition->Run();
+	}
+}
+
+}
+
+ParallelBinarySerializer::ParallelBinarySerializer(OutputStream &stream, unsigned threads)
+	: mStream(stream)
+	, mThreads(threads ? threads : utility::Thread::HardwareConcurrency())
+{
+}
+
+void ParallelBinarySerializer::Add(const Dynamic *root)
+{
+	mRoots.push_back(root);
+}
+
+bool ParallelBinarySerializer::Run()
+{
+	std::vector<Partition *> partitions;
+	partitions.reserve(mRoots.size());
+
+	for(std::vector<const Dynamic *>::iterator it = mRoots.begin(); it != mRoots.end(); ++it)
+		partitions.push_back(new Partition(*it));
+
+	mRoots.clear();
+
+	WorkQueue queue(partitions);
+	unsigned count = mThreads < partitions.size() ? mThreads : unsigned(partitions.size());
+
+	if(count > 1)
+	{
+		utility::Thread *workers = new utility::Thread[count - 1];
+
+		for(unsigned index = 0; index < count - 1; ++index)
+			workers[index].Start(&Work, &queue);
+
+		// this thread works too, a worker which failed to start is not missed.
+		Work(&queue);
+
+		delete [] workers;
+	}
+	else
+	{
+		Work(&queue);
+	}
+
+	Stitcher stitcher(mStream);
+	bool result = true;
+
+	for(std::vector<Partition *>::iterator it = partitions.begin(); it != partitions.end(); ++it)
+	{
+		result = result && (*it)->Ok() && stitcher.Write(**it);
+		delete *it;
+	}
+
+	return result;
+}
+
+} }
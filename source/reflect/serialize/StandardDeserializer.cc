@@ -5,6 +5,8 @@
 #include <reflect/Property.h>
 #include <reflect/autocast.h>
 #include <reflect/EnumType.h>
+#include <reflect/serialize/NumberFormat.h>
+#include <reflect/string/Fragment.h>
 #include <reflect/string/MutableString.h>
 #include <cctype>
 #include <cstring>
@@ -13,36 +15,50 @@
 namespace reflect { namespace serialize {
 
 StandardDeserializer::StandardDeserializer(InputStream &stream)
-	: mStream(stream)
-	, mPeekChar(0)
+	: mBuffer(stream, BufferedInputStream::NoReadAhead)
+	, mInput(mBuffer)
 	, mDeserializingText('\0')
 {
 }
 
-char StandardDeserializer::Peek()
+StandardDeserializer::StandardDeserializer(BufferedInputStream &stream)
+	: mInput(stream)
+	, mDeserializingText('\0')
 {
-	if(0 == mPeekChar)
-	{
-		if(mStream.Read(&mPeekChar, 1) != 1)
-			mPeekChar = 0;
-	}
+}
 
-	return mPeekChar;
+char StandardDeserializer::Peek()
+{
+	int c = mInput.Peek();
+	return c < 0 ? 0 : char(c);
 }
 
 char StandardDeserializer::Read()
 {
-	char result;
-	Peek();
-	result = mPeekChar;
-	mPeekChar = 0;
+	char result = Peek();
+	
+	if(result)
+		mInput.Consume(1);
+	
 	return result;
 }
 
 void StandardDeserializer::EatSpace()
 {
-	for(char c; c = Peek(), c && std::isspace(c); Read())
-		;
+	while(mInput.Available() || mInput.Fill())
+	{
+		const char *begin = mInput.Window();
+		const char *end = begin + mInput.Available();
+		const char *cursor = begin;
+
+		while(cursor != end && *cursor && std::isspace(static_cast<unsigned char>(*cursor)))
+			cursor++;
+
+		mInput.Consume(BufferedInputStream::size_type(cursor - begin));
+
+		if(cursor != end)
+			break;
+	}
 }
 
 bool StandardDeserializer::Begin(SerializationTag &tag, SerializationTag::TagType type)
@@ -72,6 +88,10 @@ bool StandardDeserializer::Begin(SerializationTag &tag, SerializationTag::TagTyp
 		{
 			tag.Type() = SerializationTag::PropertyTag;
 			Read();
+			if(Peek() == '+' || Peek() == '*')
+			{
+				return ReadName(tag.Text()) >= 0 && Read() == '=';
+			}
 			while(char c = Read())
 			{
 				if(c == '=') return true;
@@ -153,7 +173,15 @@ bool StandardDeserializer::End(SerializationTag &tag)
 				{
 					Read();
 
-					if(false == (ReadWord(discard)))
+					// name table entries must still be defined, with their text.
+					if(Peek() == '+' || Peek() == '*')
+					{
+						string::String skipped;
+
+						if(ReadName(skipped) < 0)
+							return false;
+					}
+					else if(false == (ReadWord(discard)))
 						return false;
 	
 					retry = true;
@@ -180,16 +208,52 @@ bool StandardDeserializer::End(SerializationTag &tag)
 	return true;
 }
 
+// reads "+name" (defining a name table entry) or "*offset" into name,
+// returns the entry's offset or -1.
+int StandardDeserializer::ReadName(string::MutableString name)
+{
+	char marker = Read();
+	string::ArrayString<32> offset_text;
+	long offset;
+
+	if(marker == '+' && ReadWord(name))
+	{
+		return mNames.AddString(name).Index();
+	}
+	else if(marker == '*'
+		&& ReadWord(offset_text)
+		&& ParseSigned(offset_text.data(), unsigned(offset_text.size()), offset)
+		&& offset >= 0 && string::StringBlock::size_type(offset) < mNames.size()
+		&& (offset == 0 || mNames.data()[offset - 1] == '\0'))
+	{
+		name += string::Fragment(mNames.FromIndex(int(offset)));
+		return int(offset);
+	}
+
+	return -1;
+}
+
 int StandardDeserializer::ReadWord(string::MutableString s)
 {
 	// count size seperately, don't use s.size() because s might have 0 capacity!
 	int size = 0;
 	EatSpace();
 
-	for(char c; (c = Peek(), c) && !isspace(c) && 0 == std::strchr("[]{}()$=#,;", c); Read())
+	while(mInput.Available() || mInput.Fill())
 	{
-		s += c;
-		size++;
+		const char *begin = mInput.Window();
+		const char *end = begin + mInput.Available();
+		const char *cursor = begin;
+
+		while(cursor != end && *cursor && !std::isspace(static_cast<unsigned char>(*cursor)) && 0 == std::strchr("[]{}()$=#,;", *cursor))
+			cursor++;
+
+		s += string::Fragment(begin, string::Fragment::size_type(cursor - begin));
+		size += int(cursor - begin);
+		mInput.Consume(BufferedInputStream::size_type(cursor - begin));
+
+		if(cursor != end)
+			break;
 	}
 
 	return size;
@@ -214,9 +278,7 @@ bool StandardDeserializer::Deserialize(long &value)
 	
 	if(ReadWord(s))
 	{
-		char *endp = 0;
-		value = std::strtol(s.c_str(), &endp, 0);
-		return endp == s.c_str() + s.size();
+		return ParseSigned(s.data(), unsigned(s.size()), value);
 	}
 
 	return false;
@@ -228,9 +290,7 @@ bool StandardDeserializer::Deserialize(unsigned long &value)
 	
 	if(ReadWord(s))
 	{
-		char *endp = 0;
-		value = std::strtoul(s.c_str(), &endp, 0);
-		return endp == s.c_str() + s.size();
+		return ParseUnsigned(s.data(), unsigned(s.size()), value);
 	}
 
 	return false;
@@ -243,9 +303,7 @@ bool StandardDeserializer::Deserialize(double &value)
 	
 	if(ReadWord(s))
 	{
-		char *endp = 0;
-		value = std::strtod(s.c_str(), &endp);
-		return endp == s.c_str() + s.size();
+		return ParseDouble(s.data(), unsigned(s.size()), value);
 	}
 
 	return false;
@@ -263,9 +321,13 @@ bool StandardDeserializer::Deserialize(Dynamic *&object)
 		Read();
 		EatSpace();
 
-		if(ReadWord(s))
+		bool named = Peek() == '+' || Peek() == '*'
+			? ReadName(s) >= 0
+			: ReadWord(s) != 0;
+
+		if(named)
 		{
-			if(Class *clazz = Class::FindType(s.c_str()) % autocast)
+			if(Class *clazz = mClasses.Find(s))
 			{
 				Reflector reflector(*this);
 				clazz->DeserializePointer(object, reflector);
@@ -335,51 +397,55 @@ bool StandardDeserializer::DeserializeTextChunk(char *text, unsigned &max_bytes,
 		}
 	}
 
-	char discard;
 	unsigned bytesread = 0;
-	string::MutableString::size_type output_length = 0;
-	string::MutableString output(text ? text : &discard, text ? max_bytes : 1, output_length);
 
 	if(mDeserializingText)
 	{
 		while(bytesread < max_bytes)
 		{
+			// copy the run of plain characters in the window at once.
+			const char *begin = mInput.Window();
+			const char *end = begin + mInput.Available();
+			const char *cursor = begin;
+
+			if(unsigned(end - begin) > max_bytes - bytesread)
+				end = begin + (max_bytes - bytesread);
+
+			while(cursor != end && *cursor && *cursor != '\\' && *cursor != mDeserializingText)
+				cursor++;
+
+			if(cursor != begin)
+			{
+				if(text)
+					std::memcpy(text + bytesread, begin, cursor - begin);
+
+				bytesread += unsigned(cursor - begin);
+				mInput.Consume(BufferedInputStream::size_type(cursor - begin));
+				continue;
+			}
+
 			char c = Read();
 
 			if(c == '\0')
 			{
 				return false;
 			}
-			if(c == '\\')
+			else if(c == '\\')
 			{
 				c = Read();
 				switch(c)
 				{
 				case '0':
-					output += '\0';
-					break;
-				case '\\':
-					output += '\\';
+					c = '\0';
 					break;
 				case 'n':
-					output += '\n';
+					c = '\n';
 					break;
-				case '"':
-					output += '"';
-					break;
-				case '\'':
-					output += '\'';
-					break;
-				default:
-					output += c;
+				default: // '\\', '"', '\'' and anything else stand for themselves.
 					break;
 				}
 			}
-			else if(c != mDeserializingText)
-			{
-				output += c;
-			}
-			else
+			else if(c == mDeserializingText)
 			{
 				complete = true;
 				mDeserializingText = '\0';
@@ -387,10 +453,15 @@ bool StandardDeserializer::DeserializeTextChunk(char *text, unsigned &max_bytes,
 				return true;
 			}
 
+			if(text)
+				text[bytesread] = c;
+
 			bytesread++;
 		}
 
-		return false; // malformed stream
+		// the buffer is full, the caller will ask for the rest.
+		max_bytes = bytesread;
+		return true;
 	}
 	else
 	{
@@ -398,6 +469,39 @@ bool StandardDeserializer::DeserializeTextChunk(char *text, unsigned &max_bytes,
 	}
 }
 
+bool StandardDeserializer::DeserializeTextView(string::Fragment &text)
+{
+	if(mDeserializingText || false == mInput.Resident())
+		return false;
+
+	// nothing is consumed unless the view is returned, not even the space.
+	const char *window = mInput.Window();
+	const char *end = window + mInput.Available();
+	const char *begin = window;
+
+	while(begin != end && *begin && std::isspace(static_cast<unsigned char>(*begin)))
+		begin++;
+
+	if(begin == end || (*begin != '\"' && *begin != '\''))
+		return false;
+
+	for(const char *cursor = begin + 1; cursor != end; ++cursor)
+	{
+		if(*cursor == *begin)
+		{
+			text = string::Fragment(begin + 1, string::Fragment::size_type(cursor - begin - 1));
+			mInput.Consume(BufferedInputStream::size_type(cursor + 1 - window));
+			return true;
+		}
+		else if(*cursor == '\\' || *cursor == '\0')
+		{
+			break; // needs unescaping.
+		}
+	}
+
+	return false;
+}
+
 bool StandardDeserializer::DeserializeData(void *data, unsigned size)
 {	
 	bool result = true;
@@ -455,10 +559,10 @@ bool StandardDeserializer::DeserializeEnum(int &value, const EnumType *clazz)
 	}
 	else 
 	{
-		char *end;
-		value = strtol(word.c_str(), &end, 0);
-		if(end == word.data() + word.size())
+		long number;
+		if(ParseSigned(word.data(), unsigned(word.size()), number))
 		{
+			value = int(number);
 			return true;
 		}
 		else
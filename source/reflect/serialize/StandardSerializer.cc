@@ -5,6 +5,8 @@
 #include <reflect/Property.h>
 #include <reflect/OutputStream.h>
 #include <reflect/EnumType.h>
+#include <reflect/serialize/NumberFormat.h>
+#include <reflect/serialize/ArrayElement.h>
 
 #include <reflect/string/String.h>
 
@@ -13,12 +15,46 @@
 
 namespace reflect { namespace serialize {
 
-StandardSerializer::StandardSerializer(OutputStream &stream)
+namespace {
+
+template<typename ItemType>
+ItemType Item(const void *data, unsigned index)
+{
+	return static_cast<const ItemType *>(data)[index];
+}
+
+unsigned FormatItem(char *buffer, ArrayElement element, const void *data, unsigned index)
+{
+	switch(element)
+	{
+	case CharElement: return FormatSigned(buffer, Item<char>(data, index));
+	case SignedCharElement: return FormatSigned(buffer, Item<signed char>(data, index));
+	case UnsignedCharElement: return FormatHex(buffer, Item<unsigned char>(data, index));
+	case ShortElement: return FormatSigned(buffer, Item<short>(data, index));
+	case UnsignedShortElement: return FormatHex(buffer, Item<unsigned short>(data, index));
+	case IntElement: return FormatSigned(buffer, Item<int>(data, index));
+	case UnsignedIntElement: return FormatHex(buffer, Item<unsigned int>(data, index));
+	case LongElement: return FormatSigned(buffer, Item<long>(data, index));
+	case UnsignedLongElement: return FormatHex(buffer, Item<unsigned long>(data, index));
+	case FloatElement: return FormatDouble(buffer, Item<float>(data, index));
+	case DoubleElement: return FormatDouble(buffer, Item<double>(data, index));
+	case BoolElement:
+	case NoArrayElement:
+		break;
+	}
+
+	return 0;
+}
+
+}
+
+StandardSerializer::StandardSerializer(OutputStream &stream, bool name_table)
     : mIndent(0)
     , mBreak(false)
 	, mSpace(false)
 	, mNextIndex(0)
 	, mStream(stream)
+	, mNameTable(name_table)
 {
 }
 
@@ -48,16 +84,34 @@ void StandardSerializer::Break()
 }
 
 bool StandardSerializer::Write(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    mBuffer.vformat(fmt, args);
+    va_end(args);
+
+	return WriteText(mBuffer.data(), unsigned(mBuffer.size()));
+}
+
+bool StandardSerializer::WriteText(const char *text, unsigned nbytes)
 {
 	bool result = true;
 
 #if 1
     if(mBreak)
 	{
-        mBuffer.format("\r\n%*s", mIndent*2, "");
-		result = result 
-			&& mStream.Write(mBuffer.data(), mBuffer.size()) 
-			   == OutputStream::size_type(mBuffer.size());
+		static const char spaces[] = "                                ";
+		unsigned indent = unsigned(mIndent > 0 ? mIndent*2 : 0);
+
+		result = result && mStream.Write("\r\n", 2) == 2;
+
+		while(result && indent)
+		{
+			unsigned run = indent < sizeof(spaces) - 1 ? indent : unsigned(sizeof(spaces) - 1);
+			result = mStream.Write(spaces, run) == OutputStream::size_type(run);
+			indent -= run;
+		}
+
 		mSpace = false;
 		mBreak = false;
 	}
@@ -72,18 +126,30 @@ bool StandardSerializer::Write(const char *fmt, ...)
 	mBreak = mSpace = false;
 #endif
 
-    va_list args;
-    va_start(args, fmt);
-    mBuffer.vformat(fmt, args);
-    va_end(args);
-	
 	result = result 
-		&& mStream.Write(mBuffer.data(), mBuffer.size()) 
-		== OutputStream::size_type(mBuffer.size());
+		&& mStream.Write(text, nbytes) 
+		== OutputStream::size_type(nbytes);
 
 	return result;
 }
 
+bool StandardSerializer::WriteName(const char *prefix, const char *name)
+{
+	if(false == mNameTable)
+	{
+		return Write("%s%s", prefix, name);
+	}
+	else if(string::BlockString entry = mNames.FindString(name))
+	{
+		return Write("%s*%d", prefix, entry.Index());
+	}
+	else
+	{
+		mNames.AddString(name);
+		return Write("%s+%s", prefix, name);
+	}
+}
+
 bool StandardSerializer::Begin(const SerializationTag &tag)
 {
 	bool result = false;
@@ -98,7 +164,7 @@ bool StandardSerializer::Begin(const SerializationTag &tag)
         break;
     case SerializationTag::PropertyTag:
         Break();
-		result = Write("$%s=", tag.Text().c_str());
+		result = WriteName("$", tag.Text().c_str()) && Write("=");
         Indent();
         break;
     case SerializationTag::AttributeTag:
@@ -160,14 +226,16 @@ bool StandardSerializer::Serialize(bool b)
 
 bool StandardSerializer::Serialize(long i)
 {
-    bool result = Write("%li", i);
+	char buffer[MaxNumberLength];
+    bool result = WriteText(buffer, FormatSigned(buffer, i));
 	Space();
     return result;
 }
 
 bool StandardSerializer::Serialize(unsigned long i)
 {
-    bool result = Write("0x%lX", i);
+	char buffer[MaxNumberLength];
+    bool result = WriteText(buffer, FormatHex(buffer, i));
 	Space();
     return result;
 }
@@ -175,7 +243,8 @@ bool StandardSerializer::Serialize(unsigned long i)
 
 bool StandardSerializer::Serialize(double d)
 {
-    bool result = Write("%lg", d);
+	char buffer[MaxNumberLength];
+    bool result = WriteText(buffer, FormatDouble(buffer, d));
 	Space();
     return result;
 }
@@ -186,13 +255,13 @@ bool StandardSerializer::Serialize(const Dynamic *object)
 
 	if(object)
     {
-		std::map<const Dynamic *, int>::const_iterator ref = mReferenced.find(object);
+		const int *ref = mReferenced.Find(object);
 
-		if(ref == mReferenced.end())
+		if(0 == ref)
 		{
 			const Class *serialization_class = object->GetClass()->SerializesAs();
 			Break();
-			result = Write("#%s", serialization_class->Name());
+			result = WriteName("#", serialization_class->Name());
 			Indent();
 			Space();
 			
@@ -204,7 +273,7 @@ bool StandardSerializer::Serialize(const Dynamic *object)
 		}
 		else
 		{
-			result = Write("%%%d", ref->second);
+			result = Write("%%%d", *ref);
 			Space();
 		}
     }
@@ -221,7 +290,7 @@ bool StandardSerializer::Reference(const Dynamic *object)
 {
 	bool result = false;
 
-	if(mReferenced.insert(std::make_pair(object, mNextIndex)).second)
+	if(mReferenced.Insert(object, mNextIndex))
 	{
 		result = Write("@%d", mNextIndex);
 		Break();
@@ -231,6 +300,11 @@ bool StandardSerializer::Reference(const Dynamic *object)
 	return result;
 }
 
+void StandardSerializer::Reserve(unsigned objects)
+{
+	mReferenced.Reserve(objects);
+}
+
 bool StandardSerializer::SerializeText(const char *text, unsigned nbytes)
 {
 	bool result = true;
@@ -247,7 +321,7 @@ bool StandardSerializer::SerializeText(const char *text, unsigned nbytes)
 			next_special = data.size();
 		}
 
-		result = Write("%.*s", next_special, data.data()) && result;
+		result = WriteText(data.data(), unsigned(next_special)) && result;
 
 		data = data.substr(next_special);
 
@@ -310,6 +384,36 @@ bool StandardSerializer::SerializeEnum(int value, const EnumType *clazz)
 	return result;
 }
 
+bool StandardSerializer::SerializeArray(const Type *type, const void *data, unsigned count)
+{
+	ArrayElement element = ArrayElementOf(type);
+
+	if(element == BoolElement || element == NoArrayElement)
+		return Serializer::SerializeArray(type, data, count);
+
+	bool result = true;
+	char buffer[4096];
+	unsigned size = 0;
+
+	for(unsigned index = 0; result && index < count; ++index)
+	{
+		if(index)
+			buffer[size++] = ' ';
+
+		size += FormatItem(buffer + size, element, data, index);
+
+		if(size + 1 + MaxNumberLength > sizeof(buffer) || index + 1 == count)
+		{
+			result = WriteText(buffer, size);
+			size = 0;
+		}
+	}
+
+	Space();
+
+	return result;
+}
+
 bool StandardSerializer::SerializeProperty(const void *object, const Property *prop)
 {
 	Reflector reflector(*this);
@@ -275,6 +275,13 @@ void SerializeMutableString(const MutableString *in, MutableString *out, Reflect
 		unsigned maxsize = sizeof(buffer)-1;
 		bool complete = false;
 		Deserializer &deserializer = reflector;
+		Fragment view;
+
+		if(deserializer.DeserializeTextView(view))
+		{
+			*out = view;
+			return;
+		}
 		
 		*out = "";
 
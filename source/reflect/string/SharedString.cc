@@ -6,6 +6,9 @@
 #include <reflect/utility/Context.hpp>
 #include <reflect/PrimitiveType.hpp>
 #include <reflect/PrimitiveTypes.h>
+#include <reflect/utility/Mutex.h>
+#include <reflect/utility/HashBytes.h>
+#include <cstring>
 
 #ifndef REFLECT_FAST_SHARED_STRING
 # define COMPARE(op,y) mpString op (y).mpString
@@ -117,114 +120,243 @@ int SharedString::compare(const SharedString & rhs) const
 
 ///////////////////////////////////////////////////////////
 
-StringPool::StringPool(const StringPool *parent)
-	: mParent(parent)
-{
-}
-
-const char *StringPool::FindRecursive(const Fragment &string) const
+// Class: StringPool::Shard
+// A lock and an open addressing table of the strings hashing to it,
+// and the chunks holding its copied strings.
+class StringPool::Shard
 {
-	bool search_result;
-	const char *result = NULL;
-	std::vector<const char *>::size_type pos = BinarySearch(string, search_result);
-
-	if(search_result)
+public:
+	Shard()
+		: mEntries(0)
+		, mCapacity(0)
+		, mSize(0)
+		, mChunks(0)
+		, mCursor(0)
+		, mRemaining(0)
 	{
-		result = mStringPool[pos];
 	}
-	else if(mParent)
+
+	~Shard()
 	{
-		result = mParent->FindRecursive(string);
-	}
+		delete [] mEntries;
 
-	return result;
-}
+		while(mChunks)
+		{
+			Chunk *next = mChunks->next;
+			delete [] reinterpret_cast<char *>(mChunks);
+			mChunks = next;
+		}
+	}
 
-const char *StringPool::FindFirst(const Fragment &string, std::vector<const char *>::iterator &it)
-{
-	bool search_result;
-	const char *result = NULL;
-	std::vector<const char *>::size_type pos = BinarySearch(string, search_result);
+	utility::Mutex &Lock() const { return mMutex; }
 
-	if(search_result)
+	const char *Find(const Fragment &string, unsigned hash) const
 	{
-		result = mStringPool[pos];
+		if(0 == mSize)
+			return NULL;
+
+		for(unsigned index = hash & (mCapacity - 1); ; index = (index + 1) & (mCapacity - 1))
+		{
+			const Entry &entry = mEntries[index];
+
+			if(entry.string == NULL)
+				return NULL;
+
+			if(entry.hash == hash && entry.length == string.size()
+				&& 0 == std::memcmp(entry.string, string.data(), string.size()))
+			{
+				return entry.string;
+			}
+		}
 	}
-	else if(mParent)
+
+	const char *Insert(const Fragment &string, unsigned hash, const char *literal)
 	{
-		result = mParent->FindRecursive(string);
+		if(2 * (mSize + 1) > mCapacity)
+			Grow();
+
+		if(literal == NULL)
+		{
+			char *copy = Allocate(string.size() + 1);
+			std::memcpy(copy, string.data(), string.size());
+			copy[string.size()] = '\0';
+			literal = copy;
+		}
+
+		Place(literal, unsigned(string.size()), hash);
+		mSize++;
+
+		return literal;
 	}
 
-	if(NULL == result)
+private:
+	struct Entry
 	{
-		it = mStringPool.begin() + int(pos);
-	}
+		Entry() : hash(0), length(0), string(NULL) {}
 
-	return result;
-}
+		unsigned hash;
+		unsigned length;
+		const char *string;
+	};
 
-std::vector<const char *>::size_type StringPool::BinarySearch(const Fragment &string, bool &result) const
-{
-	std::vector<const char *>::size_type lo = 0;
-	std::vector<const char *>::size_type hi = mStringPool.size();
-	
-	while(lo < hi)
+	struct Chunk
 	{
-		std::vector<const char *>::size_type mid = (lo + hi) / 2;
-		int cmp = string.compare(mStringPool[mid]);
+		Chunk *next;
+	};
+
+	enum { MinimumCapacity = 64, ChunkSize = 4096 };
 
-		if(cmp < 0)
+	void Place(const char *string, unsigned length, unsigned hash)
+	{
+		for(unsigned index = hash & (mCapacity - 1); ; index = (index + 1) & (mCapacity - 1))
 		{
-			hi = mid;
+			Entry &entry = mEntries[index];
+
+			if(entry.string == NULL)
+			{
+				entry.hash = hash;
+				entry.length = length;
+				entry.string = string;
+				return;
+			}
 		}
-		else if(cmp > 0)
+	}
+
+	void Grow()
+	{
+		Entry *entries = mEntries;
+		unsigned capacity = mCapacity;
+
+		mCapacity = mCapacity ? mCapacity * 2 : unsigned(MinimumCapacity);
+		mEntries = new Entry[mCapacity];
+
+		for(unsigned index = 0; index < capacity; ++index)
 		{
-			lo = mid + 1;
+			if(entries[index].string)
+				Place(entries[index].string, entries[index].length, entries[index].hash);
 		}
-		else
+
+		delete [] entries;
+	}
+
+	// bump allocates out of the newest chunk, long strings get a chunk to themselves.
+	char *Allocate(std::size_t size)
+	{
+		if(size > mRemaining)
 		{
-			result = true;
-			return mid;
+			std::size_t chunk_size = size > ChunkSize / 4 ? size : std::size_t(ChunkSize);
+			Chunk *chunk = reinterpret_cast<Chunk *>(new char[sizeof(Chunk) + chunk_size]);
+			char *data = reinterpret_cast<char *>(chunk + 1);
+
+			if(chunk_size == size && mChunks)
+			{
+				// keep filling the current chunk.
+				chunk->next = mChunks->next;
+				mChunks->next = chunk;
+				return data;
+			}
+
+			chunk->next = mChunks;
+			mChunks = chunk;
+			mCursor = data;
+			mRemaining = chunk_size;
 		}
+
+		char *result = mCursor;
+		mCursor += size;
+		mRemaining -= size;
+		return result;
 	}
-	
-	result = false;
-	return lo;
+
+	mutable utility::Mutex mMutex;
+	Entry *mEntries;
+	unsigned mCapacity;
+	unsigned mSize;
+	Chunk *mChunks;
+	char *mCursor;
+	std::size_t mRemaining;
+};
+
+namespace {
+
+// the top bits pick the shard, the table probes from the low bits.
+enum { ShardBits = 4, ShardCount = 1 << ShardBits };
+
 }
 
-SharedString StringPool::Copy(const Fragment &s)
+StringPool::StringPool(const StringPool *parent)
+	: mParent(parent)
+	, mShards(new Shard[ShardCount])
+{
+}
+
+StringPool::~StringPool()
+{
+	delete [] mShards;
+}
+
+unsigned StringPool::Hash(const Fragment &string)
 {
-	std::vector<const char *>::iterator insertion_point;
-	const char *string = FindFirst(s, insertion_point);
-	if(string == NULL)
+	return utility::HashBytes(string.data(), string.size());
+}
+
+StringPool::Shard &StringPool::ShardOf(unsigned hash) const
+{
+	return mShards[hash >> (32 - ShardBits)];
+}
+
+const char *StringPool::FindRecursive(const Fragment &string, unsigned hash) const
+{
+	const char *result;
+
 	{
-		char *new_string = new char[s.length() + 1];
-		std::memcpy(new_string, s.data(), s.length());
-		new_string[s.length()] = '\0';
+		Shard &shard = ShardOf(hash);
+		utility::ScopedLock lock(shard.Lock());
+		result = shard.Find(string, hash);
+	}
 
-		string = new_string;
-		mStringPool.insert(insertion_point, string);
+	if(NULL == result && mParent)
+	{
+		result = mParent->FindRecursive(string, hash);
 	}
 
-	return SharedString(string, this);
+	return result;
 }
 
-SharedString StringPool::Literal(const ConstString &s)
+const char *StringPool::Intern(const Fragment &string, const char *literal)
 {
-	std::vector<const char *>::iterator insertion_point;
-	const char *string = FindFirst(s, insertion_point);
-	if(string == NULL)
+	unsigned hash = Hash(string);
+	Shard &shard = ShardOf(hash);
+	utility::ScopedLock lock(shard.Lock());
+
+	const char *result = shard.Find(string, hash);
+
+	if(NULL == result && mParent)
+	{
+		result = mParent->FindRecursive(string, hash);
+	}
+
+	if(NULL == result)
 	{
-		string = s.c_str();
-		mStringPool.insert(insertion_point, string);
+		result = shard.Insert(string, hash, literal);
 	}
 
-	return SharedString(string, this);
+	return result;
+}
+
+SharedString StringPool::Copy(const Fragment &s)
+{
+	return SharedString(Intern(s, NULL), this);
+}
+
+SharedString StringPool::Literal(const ConstString &s)
+{
+	return SharedString(Intern(s, s.c_str()), this);
 }
 
 SharedString StringPool::Find(const Fragment &s) const
 {
-	return SharedString(FindRecursive(s), this);
+	return SharedString(FindRecursive(s, Hash(s)), this);
 }
 
 StringPoolContext::StringPoolContext()
@@ -232,7 +364,13 @@ StringPoolContext::StringPoolContext()
 {
 }
 
-static StringPoolContext sGlobalStringPoolContext;
+StringPoolContext::StringPoolContext(GlobalTag)
+	: StringPool(0)
+	, utility::Context<StringPoolContext>(Global)
+{
+}
+
+static StringPoolContext sGlobalStringPoolContext(StringPoolContext::Global);
 
 ///////////////////////////////////////////////////
 
@@ -244,6 +382,16 @@ void SharedString::Serialize(const SharedString *in, SharedString *out, reflect:
 	}
 	else
 	{
+		string::Fragment view;
+		Deserializer &deserializer = reflector;
+
+		// intern straight out of the input when it is resident.
+		if(deserializer.DeserializeTextView(view))
+		{
+			*out = string::SharedString::Copy(view);
+			return;
+		}
+
 		string::String the_string;
 
 		reflector | the_string;
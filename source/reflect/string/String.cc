@@ -384,6 +384,13 @@ void String::Deserialize(Reflector &reflector)
 	unsigned maxsize = sizeof(buffer)-1;
 	bool complete = false;
 	Deserializer &deserializer = reflector;
+	Fragment view;
+
+	if(deserializer.DeserializeTextView(view))
+	{
+		*this = view;
+		return;
+	}
 	
 	*this = "";
 
@@ -407,6 +414,59 @@ void String::Serialize(const String *in, String *out, Reflector &reflector)
 	}
 }
 
+namespace {
+
+// the StandardSerializer's quoted text, without a serializer.
+// escaped text is left to the deserializer.
+bool ParseQuoted(const Fragment &text, String &value)
+{
+	if(text.size() < 2 || (text.data()[0] != '"' && text.data()[0] != '\'')
+		|| text.data()[text.size() - 1] != text.data()[0])
+		return false;
+
+	Fragment quoted = text.substr(1, text.size() - 2);
+	char specials[] = { '\\', '\0', text.data()[0] };
+
+	if(quoted.find_first_of(Fragment(specials, sizeof(specials))) != Fragment::npos)
+		return false;
+
+	value = quoted;
+	return true;
+}
+
+bool FormatQuoted(const String &value, String &text)
+{
+	Fragment data = value;
+
+	text = "\"";
+
+	while(false == data.empty())
+	{
+		Fragment::size_type next_special = data.find_first_of(Fragment("\"\n\0\\", 4));
+
+		if(next_special == Fragment::npos)
+			next_special = data.size();
+
+		text += data.substr(0, next_special);
+		data = data.substr(next_special);
+
+		if(data.size()) switch(*data.data())
+		{
+		case '"': text += "\\\""; break;
+		case '\n': text += "\\n"; break;
+		case '\\': text += "\\\\"; break;
+		case '\0': text += "\\0"; break;
+		}
+
+		data = data.substr(1);
+	}
+
+	text += "\"";
+	return true;
+}
+
+}
+
 }  }
 
 DEFINE_STATIC_REFLECTION(reflect::string::String, "string")
@@ -414,6 +474,7 @@ DEFINE_STATIC_REFLECTION(reflect::string::String, "string")
 	using reflect::string::String;
 
 	SerializeWith<&String::Serialize>();
+	TextConversions<String, &reflect::string::ParseQuoted, &reflect::string::FormatQuoted>();
 	
 	+ Concrete;
 	+ ConversionFrom<const char *>();
@@ -0,0 +1,115 @@
+#include <reflect/utility/MappedFileInputStream.h>
+
+#if defined(_WIN32)
+# define WIN32_LEAN_AND_MEAN
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+namespace reflect { namespace utility {
+
+#if defined(_WIN32)
+
+MappedFileInputStream::MappedFileInputStream(string::ConstString filename)
+	: mMapping(0)
+	, mSize(0)
+	, mOpen(false)
+	, mFileHandle(INVALID_HANDLE_VALUE)
+	, mMappingHandle(0)
+{
+	mFileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+	if(mFileHandle == INVALID_HANDLE_VALUE)
+		return;
+
+	LARGE_INTEGER size;
+
+	if(!GetFileSizeEx(mFileHandle, &size) || size.HighPart != 0)
+		return;
+
+	mSize = size_type(size.LowPart);
+
+	if(mSize)
+	{
+		mMappingHandle = CreateFileMappingA(mFileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+		if(0 == mMappingHandle)
+			return;
+
+		mMapping = MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+		if(0 == mMapping)
+			return;
+	}
+
+	SetMemory(mMapping, mSize);
+	mOpen = true;
+}
+
+MappedFileInputStream::~MappedFileInputStream()
+{
+	if(mMapping)
+		UnmapViewOfFile(mMapping);
+
+	if(mMappingHandle)
+		CloseHandle(mMappingHandle);
+
+	if(mFileHandle != INVALID_HANDLE_VALUE)
+		CloseHandle(mFileHandle);
+}
+
+#else
+
+MappedFileInputStream::MappedFileInputStream(string::ConstString filename)
+	: mMapping(0)
+	, mSize(0)
+	, mOpen(false)
+{
+	int fd = open(filename.c_str(), O_RDONLY);
+
+	if(fd < 0)
+		return;
+
+	struct stat info;
+
+	// the window is addressed with size_type, larger files are not supported.
+	if(0 == fstat(fd, &info) && off_t(size_type(info.st_size)) == info.st_size)
+	{
+		mSize = size_type(info.st_size);
+
+		if(0 == mSize)
+		{
+			mOpen = true;
+		}
+		else
+		{
+			void *mapping = mmap(0, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			if(mapping != MAP_FAILED)
+			{
+				madvise(mapping, mSize, MADV_SEQUENTIAL);
+				mMapping = mapping;
+				mOpen = true;
+				SetMemory(mMapping, mSize);
+			}
+		}
+	}
+
+	// the mapping keeps the file alive.
+	close(fd);
+}
+
+MappedFileInputStream::~MappedFileInputStream()
+{
+	if(mMapping)
+		munmap(mMapping, mSize);
+}
+
+#endif
+
+} }
@@ -0,0 +1,62 @@
+#include <reflect/utility/Mutex.h>
+
+#if defined(_WIN32)
+# define WIN32_LEAN_AND_MEAN
+# include <windows.h>
+#else
+# include <pthread.h>
+#endif
+
+namespace reflect { namespace utility {
+
+#if defined(_WIN32)
+
+Mutex::Mutex()
+	: mHandle(new CRITICAL_SECTION)
+{
+	InitializeCriticalSection(static_cast<CRITICAL_SECTION *>(mHandle));
+}
+
+Mutex::~Mutex()
+{
+	DeleteCriticalSection(static_cast<CRITICAL_SECTION *>(mHandle));
+	delete static_cast<CRITICAL_SECTION *>(mHandle);
+}
+
+void Mutex::Lock()
+{
+	EnterCriticalSection(static_cast<CRITICAL_SECTION *>(mHandle));
+}
+
+void Mutex::Unlock()
+{
+	LeaveCriticalSection(static_cast<CRITICAL_SECTION *>(mHandle));
+}
+
+#else
+
+Mutex::Mutex()
+	: mHandle(new pthread_mutex_t)
+{
+	pthread_mutex_init(static_cast<pthread_mutex_t *>(mHandle), 0);
+}
+
+Mutex::~Mutex()
+{
+	pthread_mutex_destroy(static_cast<pthread_mutex_t *>(mHandle));
+	delete static_cast<pthread_mutex_t *>(mHandle);
+}
+
+void Mutex::Lock()
+{
+	pthread_mutex_lock(static_cast<pthread_mutex_t *>(mHandle));
+}
+
+void Mutex::Unlock()
+{
+	pthread_mutex_unlock(static_cast<pthread_mutex_t *>(mHandle));
+}
+
+#endif
+
+} }
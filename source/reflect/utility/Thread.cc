@@ -0,0 +1,131 @@
+#include <reflect/utility/Thread.h>
+
+#if defined(_WIN32)
+# define WIN32_LEAN_AND_MEAN
+# include <windows.h>
+#else
+# include <pthread.h>
+# include <unistd.h>
+#endif
+
+namespace reflect { namespace utility {
+
+namespace {
+
+// what a new thread runs, owned by the thread.
+struct Invocation
+{
+	Invocation(Thread::Function function, void *argument)
+		: function(function)
+		, argument(argument)
+	{
+	}
+
+	Thread::Function function;
+	void *argument;
+};
+
+#if defined(_WIN32)
+DWORD WINAPI Run(LPVOID data)
+#else
+void *Run(void *data)
+#endif
+{
+	Invocation *invocation = static_cast<Invocation *>(data);
+	Invocation call = *invocation;
+	delete invocation;
+
+	call.function(call.argument);
+
+	return 0;
+}
+
+}
+
+Thread::Thread()
+	: mHandle(0)
+{
+}
+
+Thread::~Thread()
+{
+	Join();
+}
+
+#if defined(_WIN32)
+
+bool Thread::Start(Function function, void *argument)
+{
+	if(mHandle)
+		return false;
+
+	Invocation *invocation = new Invocation(function, argument);
+
+	if(0 == (mHandle = CreateThread(NULL, 0, &Run, invocation, 0, NULL)))
+	{
+		delete invocation;
+		return false;
+	}
+
+	return true;
+}
+
+void Thread::Join()
+{
+	if(mHandle)
+	{
+		WaitForSingleObject(mHandle, INFINITE);
+		CloseHandle(mHandle);
+		mHandle = 0;
+	}
+}
+
+unsigned Thread::HardwareConcurrency()
+{
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+
+	return info.dwNumberOfProcessors ? unsigned(info.dwNumberOfProcessors) : 1;
+}
+
+#else
+
+bool Thread::Start(Function function, void *argument)
+{
+	if(mHandle)
+		return false;
+
+	Invocation *invocation = new Invocation(function, argument);
+	pthread_t *thread = new pthread_t;
+
+	if(0 != pthread_create(thread, 0, &Run, invocation))
+	{
+		delete thread;
+		delete invocation;
+		return false;
+	}
+
+	mHandle = thread;
+	return true;
+}
+
+void Thread::Join()
+{
+	if(pthread_t *thread = static_cast<pthread_t *>(mHandle))
+	{
+		pthread_join(*thread, 0);
+		delete thread;
+		mHandle = 0;
+	}
+}
+
+unsigned Thread::HardwareConcurrency()
+{
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return count > 0 ? unsigned(count) : 1;
+}
+
+#endif
+
+} }
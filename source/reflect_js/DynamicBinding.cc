@@ -5,18 +5,132 @@
 //#include <reflect/PrimitiveTypes.h>
 #include <reflect/string/String.h>
 #include <reflect/function/Function.h>
+#include <reflect/PersistentClass.h>
 
 namespace reflect { namespace js {
 
+PropertyCache::Entry::Entry()
+	: property(0)
+	, data(0)
+	, function(0)
+{
+}
+
+PropertyCache::PropertyCache(const PersistentClass *clazz)
+	: mClass(clazz)
+	, mGeneration(Type::LookupGeneration())
+{
+}
+
+int PropertyCache::Slot(const char *name)
+{
+	string::SharedString shared = string::SharedString::Copy(name);
+
+	if(const int *slot = mSlots.Find(shared.data()))
+		return *slot;
+
+	if(mEntries.size() >= MaxSlots)
+		return -1;
+
+	int slot = int(mEntries.size());
+	mEntries.push_back(Entry());
+	mEntries.back().name = shared;
+	Resolve(mEntries.back());
+	mSlots.Insert(shared.data(), slot);
+	return slot;
+}
+
+const PropertyCache::Entry *PropertyCache::Find(int slot)
+{
+	if(slot < 0 || slot >= int(mEntries.size()))
+		return 0;
+
+	if(mGeneration != Type::LookupGeneration())
+	{
+		mGeneration = Type::LookupGeneration();
+
+		for(std::vector<Entry>::iterator it = mEntries.begin(); it != mEntries.end(); ++it)
+			Resolve(*it);
+	}
+
+	return &mEntries[slot];
+}
+
+void PropertyCache::Resolve(Entry &entry) const
+{
+	entry.property = mClass->FindProperty(entry.name);
+	entry.data = entry.property % autocast;
+	entry.function = mClass->FindFunction(entry.name);
+	entry.ints.Bind(0);
+	entry.strings.Bind(0);
+
+	if(entry.data && entry.data->DataType() == TypeOf<int>())
+		entry.ints.Bind(entry.data);
+	else if(entry.data && entry.data->DataType() == TypeOf<string::String>())
+		entry.strings.Bind(entry.data);
+}
+
+// the cached entry of a property defined with a tinyid by DefineDynamicProperty.
+static const PropertyCache::Entry *CachedProperty(JSContext *cx, const Dynamic *dynamic, jsval id)
+{
+	if(!JSVAL_IS_INT(id))
+		return 0;
+
+	if(const Persistent *persistent = dynamic % autocast)
+		return GetRuntimeData(JS_GetRuntime(cx))->Properties(persistent->GetClass()).Find(JSVAL_TO_INT(id));
+
+	return 0;
+}
+
+static JSBool ReadDynamicPropertyByName(JSContext *cx, Dynamic *dynamic, const char *id_string, jsval *vp);
+static JSBool WriteDynamicPropertyByName(JSContext *cx, Persistent *persistent, const char *id_string, jsval *vp);
+
 static JSBool ReadDynamicProperty(JSContext *cx, JSObject *obj, jsval id, jsval *vp)
 {
-	using reflect::Persistent;
-	using reflect::TypeOf;
-	Dynamic *dynamic = translucent_cast<Dynamic *>(JS_GetPrivate(cx, obj));
+	void *opaque = JS_GetPrivate(cx, obj);
+	Dynamic *dynamic = translucent_cast<Dynamic *>(opaque);
+
+	if(const PropertyCache::Entry *entry = CachedProperty(cx, dynamic, id))
+	{
+		if(entry->ints.Valid())
+		{
+			int value;
+
+			if(!entry->ints.Read(opaque, value))
+				return JS_FALSE;
+
+			*vp = INT_TO_JSVAL(value);
+			return JS_TRUE;
+		}
+		else if(entry->strings.Valid())
+		{
+			string::String value;
+
+			if(!entry->strings.Read(opaque, value))
+				return JS_FALSE;
+
+			*vp = STRING_TO_JSVAL(JS_NewStringCopyZ(cx, value.c_str()));
+			return JS_TRUE;
+		}
+		else if(0 == entry->property && entry->function)
+		{
+			return JS_TRUE;
+		}
+
+		// other properties are read as paths.
+		return ReadDynamicPropertyByName(cx, dynamic, entry->name.c_str(), vp);
+	}
+
 	JSString *id_str = JS_ValueToString(cx, id);
 	if(!id_str) return JS_FALSE;	
 	
-	const char *id_string = JS_GetStringBytes(id_str);
+	return ReadDynamicPropertyByName(cx, dynamic, JS_GetStringBytes(id_str), vp);
+}
+
+static JSBool ReadDynamicPropertyByName(JSContext *cx, Dynamic *dynamic, const char *id_string, jsval *vp)
+{
+	using reflect::Persistent;
+	using reflect::TypeOf;
 
 	if(Persistent *persistent = dynamic % autocast)
 	{
@@ -64,15 +178,33 @@ static JSBool ReadDynamicProperty(JSContext *cx, JSObject *obj, jsval id, jsval
 
 static JSBool WriteDynamicProperty(JSContext *cx, JSObject *obj, jsval id, jsval *vp)
 {
-	using reflect::Persistent;
-	using reflect::TypeOf;
-	Persistent *persistent = translucent_cast<Persistent *>(JS_GetPrivate(cx, obj));
+	void *opaque = JS_GetPrivate(cx, obj);
+	Persistent *persistent = translucent_cast<Persistent *>(opaque);
+
+	if(const PropertyCache::Entry *entry = CachedProperty(cx, persistent, id))
+	{
+		if(entry->ints.Valid() && JSVAL_IS_INT(*vp))
+		{
+			return entry->ints.Write(opaque, JSVAL_TO_INT(*vp)) ? JS_TRUE : JS_FALSE;
+		}
+		else if(entry->ints.Valid() || entry->strings.Valid())
+		{
+			Variant native;
+			JavaToVariant(cx, native, *vp);
+			return entry->data->WriteData(opaque, native) ? JS_TRUE : JS_FALSE;
+		}
+
+		return WriteDynamicPropertyByName(cx, persistent, entry->name.c_str(), vp);
+	}
 	
 	JSString *id_str = JS_ValueToString(cx, id);
 	if(!id_str) return JS_FALSE;
 	
-	const char *id_string = JS_GetStringBytes(id_str);
-	
+	return WriteDynamicPropertyByName(cx, persistent, JS_GetStringBytes(id_str), vp);
+}
+
+static JSBool WriteDynamicPropertyByName(JSContext *cx, Persistent *persistent, const char *id_string, jsval *vp)
+{
 	reflect::PropertyPath path = persistent->Property(id_string);
 
 	Variant native;
@@ -86,14 +218,30 @@ static JSBool WriteDynamicProperty(JSContext *cx, JSObject *obj, jsval id, jsval
 	return JS_FALSE;
 }
 
+// defines *name* on *obj*, with its slot in the class' <PropertyCache> as tinyid.
+static void DefineDynamicProperty(JSContext *cx, JSObject *obj, const Persistent *persistent, const char *name)
+{
+	int slot = GetRuntimeData(JS_GetRuntime(cx))->Properties(persistent->GetClass()).Slot(name);
+
+	if(slot >= 0)
+	{
+		JS_DefinePropertyWithTinyId(cx, obj, name, int8(slot), JSVAL_NULL, ReadDynamicProperty, WriteDynamicProperty, 
+			JSPROP_ENUMERATE | JSPROP_PERMANENT);
+	}
+	else
+	{
+		JS_DefineProperty(cx, obj, name, JSVAL_NULL, ReadDynamicProperty, WriteDynamicProperty, 
+			JSPROP_ENUMERATE | JSPROP_PERMANENT);
+	}
+}
+
 static JSBool EnumerateDynamicProperties(JSContext *cx, JSObject *obj)
 {
 	if(Persistent *persistent = translucent_cast<Dynamic *>(JS_GetPrivate(cx, obj)) % autocast)
 	{
 		for(PersistentClass::PropertyIterator it = persistent->GetClass(); it; it.next())
 		{
-			JS_DefineProperty(cx, obj, it->first.c_str(), JSVAL_NULL, ReadDynamicProperty, WriteDynamicProperty, 
-				JSPROP_ENUMERATE | JSPROP_PERMANENT);
+			DefineDynamicProperty(cx, obj, persistent, it->first.c_str());
 		}
 	}
 	
@@ -113,8 +261,7 @@ static JSBool ResolveDynamicProperty(JSContext *cx, JSObject *obj, jsval id)
 	{
 		if(persistent->Property(id_name).GetType() != reflect::PropertyPath::Invalid)
 		{
-			JS_DefineProperty(cx, obj, id_name, JSVAL_NULL, ReadDynamicProperty, WriteDynamicProperty, 
-				JSPROP_ENUMERATE | JSPROP_PERMANENT);
+			DefineDynamicProperty(cx, obj, persistent, id_name);
 			return JS_TRUE;
 		}
 	}
@@ -9,7 +9,6 @@
 #include <reflect_js/JavaScript_private.h>
 #include <jsapi.h>
 #include <jsdbgapi.h>
-#include <map>
 
 
 template class reflect::utility::Context<reflect::js::CallContextObject>;
@@ -28,77 +27,90 @@ RuntimeData::JavaInfo::JavaInfo(JSObject *obj)
 
 void RuntimeData::DecRef(void *opaque)
 {
-	JavaInfo &info = mOpaqueToObject[opaque];
+	JavaInfo &info = mOpaqueToObject.FindOrInsert(opaque);
 	--info.native_reference_count;
 	
 	if(0 == info.native_reference_count && info.object)
 	{
-		JavaToNativeMap::iterator it = mObjectToOpaque.find(info.object);
+		NativeInfo *native = mObjectToOpaque.Find(info.object);
 	
-		if(mObjectToOpaque.end() == it)
+		if(0 == native)
 		{
-			mOpaqueToObject.erase(opaque);
-			
-			delete [] static_cast<char *>(it->second.type->Destruct(opaque));
-
-			mObjectToOpaque.erase(it);
+			// the wrapper is gone, nothing knows the type to destroy.
+			mOpaqueToObject.Remove(opaque);
 		}
 	}
 }
 
 void RuntimeData::IncRef(void *opaque)
 {
-	mOpaqueToObject[opaque].native_reference_count++;
+	mOpaqueToObject.FindOrInsert(opaque).native_reference_count++;
 }
 
 void RuntimeData::ReleaseJavaObject(JSObject *object)
 {
-	JavaToNativeMap::iterator it = mObjectToOpaque.find(object);
-
-	if(it != mObjectToOpaque.end())
+	if(NativeInfo *native = mObjectToOpaque.Find(object))
 	{
-		NativeToJavaMap::iterator nit = mOpaqueToObject.find(it->second.opaque);
-		if(0 == nit->second.native_reference_count)
+		const NativeInfo released = *native;
+		mObjectToOpaque.Remove(object);
+		mStatistics.released++;
+		mStatistics.live--;
+
+		JavaInfo *info = mOpaqueToObject.Find(released.opaque);
+
+		if(0 == info)
+			return;
+
+		if(0 == info->native_reference_count)
 		{
-			delete [] static_cast<char *>(it->second.type->Destruct(nit->first));
-			mOpaqueToObject.erase(nit);
+			mOpaqueToObject.Remove(released.opaque);
+			delete [] static_cast<char *>(released.type->Destruct(released.opaque));
+			mStatistics.destroyed++;
 		}
 		else
 		{
-			nit->second.object = 0;
+			info->object = 0;
 		}
-
-		mObjectToOpaque.erase(it);
 	}
 }
 
 JSObject *RuntimeData::GetJavaObject(JSContext *cx, void *opaque, const Type *type, JSClass *repclass)
 {
-	JavaInfo &info = mOpaqueToObject[opaque];
-
-	if(info.object == 0)
+	if(const JavaInfo *info = mOpaqueToObject.Find(opaque))
 	{
-		JSObject *proto = FindPrototype(type);
-		
-		info.object = JS_NewObject(cx, repclass, proto, 0);
-		
-		if(!info.object)
+		if(info->object)
 		{
-			JS_ReportError(cx, "Error: Out of memory");
-			return 0;
+			mStatistics.reused++;
+			return info->object;
 		}
-		JS_SetPrivate(cx, info.object, opaque);
-		JS_SetReservedSlot(cx, info.object, 0, PRIVATE_TO_JSVAL(type));
-		NativeInfo &native = mObjectToOpaque[info.object];
+	}
+
+	JSObject *proto = FindPrototype(type);
 	
-		if(native.type == 0)
-		{
-			native.type = type;
-			native.opaque = opaque;
-		}
+	// may collect garbage, changing the tables.
+	JSObject *object = JS_NewObject(cx, repclass, proto, 0);
+	
+	if(!object)
+	{
+		JS_ReportError(cx, "Error: Out of memory");
+		return 0;
 	}
+	JS_SetPrivate(cx, object, opaque);
+	JS_SetReservedSlot(cx, object, 0, PRIVATE_TO_JSVAL(type));
+
+	mOpaqueToObject.FindOrInsert(opaque).object = object;
+	NativeInfo &native = mObjectToOpaque.FindOrInsert(object);
+
+	if(native.type == 0)
+	{
+		native.type = type;
+		native.opaque = opaque;
+	}
+
+	mStatistics.created++;
+	mStatistics.live++;
 	
-	return info.object;
+	return object;
 }
 
 static const uint32 gc_heap_size = 20 << 10;
@@ -173,6 +185,14 @@ JavaScriptRuntime::JavaScriptRuntime(const JavaScriptRuntime &other)
 	SharedLink(other);
 }
 
+WrapperStatistics JavaScriptRuntime::GetWrapperStatistics() const
+{
+	if(RuntimeData *data = mRuntime ? GetRuntimeData(mRuntime) : 0)
+		return data->Statistics();
+
+	return WrapperStatistics();
+}
+
 JavaScriptRuntime::~JavaScriptRuntime()
 {
 	if(this != &sSharedRuntime && SharedRelease())
@@ -532,7 +552,7 @@ bool JavaScriptContext::CallReturn(Variant &value)
 
 void RuntimeData::SetPrototype(const Type *type, JSObject *proto)
 {
-	mTypePrototypes[type] = proto;
+	mTypePrototypes.FindOrInsert(type) = proto;
 }
 
 void RuntimeData::MakeNativeObject(JSContext *cx)
@@ -548,16 +568,27 @@ void RuntimeData::MakeNativeObject(JSContext *cx)
 	}
 }
 
+PropertyCache &RuntimeData::Properties(const PersistentClass *clazz)
+{
+	if(PropertyCache *const *cache = mPropertyCaches.Find(clazz))
+		return **cache;
+
+	PropertyCache *cache = new PropertyCache(clazz);
+	mPropertyCaches.Insert(clazz, cache);
+	mPropertyCacheList.push_back(cache);
+	return *cache;
+}
+
 RuntimeData::~RuntimeData()
 {
+	for(std::vector<PropertyCache *>::iterator it = mPropertyCacheList.begin(); it != mPropertyCacheList.end(); ++it)
+		delete *it;
 }
 
 JSObject *RuntimeData::FindPrototype(const Type *type) const
 {
-	NativePrototypeMap::const_iterator it = mTypePrototypes.find(type);
-
-	if(it != mTypePrototypes.end())
-		return it->second;
+	if(JSObject *const *proto = mTypePrototypes.Find(type))
+		return *proto;
 
 	return 0;
 }
@@ -39,6 +39,7 @@ public:
 	TestType()
 		: mNumber(0)
 		, mName()
+		, mRatio(0)
 		, mDeleted(0)
 	{
 	}
@@ -50,6 +51,8 @@ public:
 	
 	reflect::string::ConstString Name() { return mName; }
 	int Number() { return mNumber; }
+	float Ratio() { return mRatio; }
+	TestType *Self() { return this; }
 	
 	int AppendName(const char *ex)
 	{
@@ -83,6 +86,7 @@ public:
 private:
 	int mNumber;
 	reflect::string::String mName;
+	float mRatio;
 	int test_array[2];
 	bool *mDeleted;
 };
@@ -109,6 +113,7 @@ DEFINE_REFLECTION(TestType, "reflect::js::TestType")
 	Properties
 		("name", &TestType::mName)
 		("number", &TestType::mNumber)
+		("ratio", &TestType::mRatio)
 		("ta", &TestType::test_array, Array)
 		;
 		
@@ -117,6 +122,7 @@ DEFINE_REFLECTION(TestType, "reflect::js::TestType")
 		("AddNumber", &TestType::AddNumber)
 		("vec", &TestType::vec)
 		("PrintVec", &TestType::PrintVec)
+		("Self", &TestType::Self)
 		;
 }
 
@@ -179,3 +185,72 @@ FIXTURE(ReadNumber, JSFixture)
 #endif
 	CHECK(ctx->Eval("Console()"));
 }
+
+FIXTURE(CachedProperties, JSFixture)
+{
+	reflect::Variant object;
+	CHECK(ctx->Eval("cached = new Native.reflect.js.TestType", object));
+	CHECK(object.CanRefAs<TestType>());
+	TestType *test_object = &object.AsRef<TestType>();
+
+	// int and String properties, through the class' property cache.
+	CHECK(ctx->Eval("cached.number = 100"));
+	CHECK_EQUAL(100, test_object->Number());
+	CHECK(ctx->Eval("cached.name = 'name'"));
+	CHECK_EQUAL("name", test_object->Name());
+
+	int number = 0;
+	CHECK(ctx->Eval("cached.number + 1", number));
+	CHECK_EQUAL(101, number);
+
+	reflect::string::String name;
+	CHECK(ctx->Eval("cached.name + '!'", name));
+	CHECK_EQUAL("name!", name);
+
+	// other properties are written by name.
+	CHECK(ctx->Eval("cached.ratio = 2.5"));
+	CHECK_EQUAL(2.5f, test_object->Ratio());
+
+	// a second object of the class shares the slots.
+	CHECK(ctx->Eval("other = new Native.reflect.js.TestType; other.number = 3; other.name = 'other'"));
+	CHECK(ctx->Eval("cached.number * 10 + other.number", number));
+	CHECK_EQUAL(1003, number);
+	CHECK(ctx->Eval("other.name", name));
+	CHECK_EQUAL("other", name);
+
+	CHECK(ctx->Eval("delete cached; delete other;"));
+}
+
+FIXTURE(WrapperIdentity, JSFixture)
+{
+	reflect::js::JavaScriptRuntime runtime = reflect::js::JavaScriptRuntime::SharedRuntime();
+	ctx->GC();
+	reflect::js::WrapperStatistics before = runtime.GetWrapperStatistics();
+
+	reflect::Variant object;
+	CHECK(ctx->Eval("wrapped = new Native.reflect.js.TestType", object));
+	CHECK(object.CanRefAs<TestType>());
+	TestType *test_object = &object.AsRef<TestType>();
+	bool deleted = false;
+	test_object->SetWhenDeleted(deleted);
+
+	// passing the object back to the script finds the same wrapper.
+	bool same = false;
+	CHECK(ctx->Eval("wrapped.Self() === wrapped && wrapped.Self().Self() === wrapped", same));
+	CHECK(same);
+
+	reflect::js::WrapperStatistics during = runtime.GetWrapperStatistics();
+	CHECK_EQUAL(before.created + 1, during.created);
+	CHECK_EQUAL(before.reused + 3, during.reused);
+	CHECK_EQUAL(before.live + 1, during.live);
+
+	// collecting the wrapper destroys the object nothing else references.
+	CHECK(ctx->Eval("delete wrapped;"));
+	ctx->GC();
+	CHECK(deleted);
+
+	reflect::js::WrapperStatistics after = runtime.GetWrapperStatistics();
+	CHECK_EQUAL(before.released + 1, after.released);
+	CHECK_EQUAL(before.destroyed + 1, after.destroyed);
+	CHECK_EQUAL(before.live, after.live);
+}
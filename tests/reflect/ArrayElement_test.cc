@@ -0,0 +1,87 @@
+#include <reflect/Persistent.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/utility/InOutReflector.h>
+#include <reflect/test/Test.h>
+
+#include <vector>
+
+using namespace reflect;
+
+class array_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	std::vector<float> samples;
+	std::vector<unsigned char> bytes;
+	std::vector<short> shorts;
+	double fixed[3];
+};
+
+DEFINE_REFLECTION(array_tester, "reflect_test::array_tester")
+{
+	+ Concrete;
+
+	Properties
+		("samples", &array_tester::samples, Array)
+		("bytes", &array_tester::bytes, Array)
+		("shorts", &array_tester::shorts, Array)
+		("fixed", &array_tester::fixed, Array)
+		;
+}
+
+template<typename InOutReflectorType>
+static bool RoundTripsArrays()
+{
+	array_tester x;
+
+	for(int i = 0; i < 5000; i++)
+	{
+		x.samples.push_back(float(i) / 7);
+		x.bytes.push_back((unsigned char)(i * 13));
+		x.shorts.push_back(short(-i * 5));
+	}
+
+	x.fixed[0] = 0.1;
+	x.fixed[1] = -1e300;
+	x.fixed[2] = 3;
+
+	InOutReflectorType reflector;
+	array_tester copy;
+	reflector << x;
+	reflector >> copy;
+
+	return reflector.Ok()
+		&& x.samples == copy.samples
+		&& x.bytes == copy.bytes
+		&& x.shorts == copy.shorts
+		&& x.fixed[0] == copy.fixed[0]
+		&& x.fixed[1] == copy.fixed[1]
+		&& x.fixed[2] == copy.fixed[2];
+}
+
+TEST(BulkArrays)
+{
+	CHECK(RoundTripsArrays<utility::BinaryInOutReflector>());
+	CHECK(RoundTripsArrays<utility::StandardInOutReflector>());
+
+	// binary arrays convert when read as another element type.
+	utility::BinaryInOutReflector reflector;
+	Serializer &out = reflector.GetSerializer();
+	Deserializer &in = reflector.GetDeserializer();
+
+	const float floats[] = { 1.5f, -2, 1e20f };
+	double doubles[3];
+	const int ints[] = { -1, 70000, 3 };
+	long longs[3];
+
+	CHECK(out.SerializeArray(TypeOf<float>(), floats, 3));
+	CHECK(out.SerializeArray(TypeOf<int>(), ints, 3));
+	CHECK(in.DeserializeArray(TypeOf<double>(), doubles, 3));
+	CHECK(in.DeserializeArray(TypeOf<long>(), longs, 3));
+	CHECK_EQUAL(1.5, doubles[0]);
+	CHECK_EQUAL(-2.0, doubles[1]);
+	CHECK_EQUAL(double(1e20f), doubles[2]);
+	CHECK_EQUAL(-1L, longs[0]);
+	CHECK_EQUAL(70000L, longs[1]);
+	CHECK_EQUAL(3L, longs[2]);
+}
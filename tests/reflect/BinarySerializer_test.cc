@@ -0,0 +1,216 @@
+#include <reflect/Persistent.h>
+#include <reflect/string/String.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/utility/InOutReflector.h>
+#include <reflect/utility/SaveLoad.h>
+#include <reflect/test/Test.h>
+
+#include <vector>
+#include <map>
+#include <cstdio>
+#include <limits>
+
+using namespace reflect;
+
+class binary_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	binary_tester()
+		: number(0)
+		, real(0)
+		, flag(false)
+		, link(0)
+	{
+	}
+
+	int number;
+	double real;
+	bool flag;
+	string::String text;
+	std::vector<int> values;
+	std::map<int, string::String> names;
+	binary_tester *link;
+};
+
+DEFINE_REFLECTION(binary_tester, "reflect_test::binary_tester")
+{
+	+ Concrete;
+
+	Properties
+		("number", &binary_tester::number)
+		("real", &binary_tester::real)
+		("flag", &binary_tester::flag)
+		("text", &binary_tester::text)
+		("values", &binary_tester::values, Array)
+		("names", &binary_tester::names, Map)
+		("link", &binary_tester::link)
+		;
+}
+
+static void FillBinaryTester(binary_tester &x)
+{
+	x.number = -123456;
+	x.real = 0.1;
+	x.flag = true;
+	x.text = "a string which is quite a bit longer than the sixty-three bytes read per chunk";
+	x.values.push_back(0);
+	x.values.push_back(-1);
+	x.values.push_back(1 << 30);
+	x.names[3] = "three";
+	x.names[-7] = "minus seven";
+	x.link = &x;
+}
+
+static bool SameBinaryTester(const binary_tester &x, const binary_tester &copy)
+{
+	return x.number == copy.number
+		&& x.real == copy.real
+		&& x.flag == copy.flag
+		&& x.text == copy.text
+		&& x.values == copy.values
+		&& x.names == copy.names;
+}
+
+TEST(BinaryIO)
+{
+	utility::BinaryInOutReflector reflector;
+
+	reflector << 1 << -3 << 5u << 7.5 << true;
+
+	int i;
+	unsigned u;
+	double d;
+	bool b;
+
+	reflector >> i;
+	CHECK_EQUAL(1, i);
+	reflector >> i;
+	CHECK_EQUAL(-3, i);
+	reflector >> u;
+	CHECK_EQUAL(5u, u);
+	reflector >> d;
+	CHECK_EQUAL(7.5, d);
+	reflector >> b;
+	CHECK_EQUAL(true, b);
+
+	binary_tester x;
+	FillBinaryTester(x);
+
+	binary_tester copy;
+	reflector << x << 33;
+	reflector >> copy >> i;
+
+	CHECK(reflector.Ok());
+	CHECK(SameBinaryTester(x, copy));
+	CHECK_EQUAL(33, i);
+	CHECK(copy.link && copy.link->link == copy.link);
+	CHECK(copy.link && copy.link != &copy);
+	delete copy.link;
+
+	// the binary format is meant to be smaller than the text one.
+	utility::StandardInOutReflector text;
+	utility::BinaryInOutReflector binary;
+	text << x;
+	binary << x;
+	CHECK(binary.Data().size() < text.Data().size());
+}
+
+TEST(BinaryDoubles)
+{
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	const double inf = std::numeric_limits<double>::infinity();
+
+	utility::BinaryInOutReflector doubles;
+	doubles << nan << 1e300 << -inf << -2.5;
+
+	double d = 0;
+	doubles >> d;
+	CHECK(d != d);
+	doubles >> d;
+	CHECK_EQUAL(1e300, d);
+	doubles >> d;
+	CHECK_EQUAL(-inf, d);
+	doubles >> d;
+	CHECK_EQUAL(-2.5, d);
+	CHECK(doubles.Ok());
+
+	// doubles an integer can't hold fail the read.
+	int i = 0;
+	long l = 0;
+	unsigned u = 0;
+
+	utility::BinaryInOutReflector nan_int;
+	nan_int << nan;
+	nan_int >> i;
+	CHECK(!nan_int.Ok());
+
+	utility::BinaryInOutReflector huge_long;
+	huge_long << 1e300;
+	huge_long >> l;
+	CHECK(!huge_long.Ok());
+
+	utility::BinaryInOutReflector negative_unsigned;
+	negative_unsigned << -2.5;
+	negative_unsigned >> u;
+	CHECK(!negative_unsigned.Ok());
+
+	utility::BinaryInOutReflector truncated;
+	truncated << -2.5;
+	truncated >> i;
+	CHECK(truncated.Ok());
+	CHECK_EQUAL(-2, i);
+}
+
+TEST(BinarySkipsUnknownData)
+{
+	utility::BinaryInOutReflector reflector;
+	serialize::BinarySerializer &serializer = reflector.GetSerializer();
+	Serializer &out = serializer;
+
+	SerializationTag item("", SerializationTag::ItemTag);
+	SerializationTag number("number", SerializationTag::PropertyTag);
+	SerializationTag unknown("unknown", SerializationTag::PropertyTag);
+	SerializationTag extra("extra", SerializationTag::AttributeTag);
+
+	out.Begin(item);
+	out.Begin(unknown);
+	out.Begin(extra);
+	out.Serialize(2.5);
+	out.End(extra);
+	out.SerializeText("ignored", 7);
+	out.End(unknown);
+	out.Begin(number);
+	out.Serialize(long(42));
+	out.Serialize(long(43)); // excess data
+	out.End(number);
+	out.End(item);
+
+	binary_tester copy;
+	reflector >> copy;
+
+	CHECK(reflector.Ok());
+	CHECK_EQUAL(42, copy.number);
+}
+
+TEST(BinaryFile)
+{
+	binary_tester x;
+	FillBinaryTester(x);
+
+	const char *filename = "binary_test.tmp";
+
+	binary_tester *copy = 0;
+	CHECK(utility::SaveBinaryFile(&x, filename));
+	CHECK(utility::LoadBinaryFile(copy, filename));
+	std::remove(filename);
+
+	CHECK(copy != 0);
+
+	if(copy)
+	{
+		CHECK(SameBinaryTester(x, *copy));
+		CHECK(copy->link == copy);
+		delete copy;
+	}
+}
@@ -0,0 +1,61 @@
+#include <reflect/Persistent.h>
+#include <reflect/string/String.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/utility/InOutReflector.h>
+#include <reflect/test/Test.h>
+
+#include <string>
+#include <cstring>
+
+using namespace reflect;
+
+class unread_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	unread_tester() : number(0) {}
+
+	int number;
+	string::String text;
+};
+
+DEFINE_REFLECTION(unread_tester, "reflect_test::unread_tester")
+{
+	+ Concrete;
+
+	Properties
+		("number", &unread_tester::number)
+		("text", &unread_tester::text)
+		;
+}
+
+template<typename InOutReflectorType>
+static bool LeavesUnreadData()
+{
+	unread_tester x;
+	x.number = -7;
+	x.text = "followed by another value";
+
+	InOutReflectorType reflector;
+	reflector << x;
+	std::size_t first = reflector.Data().size();
+	reflector << 33;
+	std::string written(reflector.Data().data(), reflector.Data().size());
+
+	// nothing past the object is read, what's left is the second value.
+	unread_tester copy;
+	reflector >> copy;
+
+	const string::String &unread = reflector.Data();
+
+	return reflector.Ok()
+		&& copy.number == x.number
+		&& unread.size() == written.size() - first
+		&& 0 == std::memcmp(unread.data(), written.data() + first, unread.size());
+}
+
+TEST(UnreadData)
+{
+	CHECK(LeavesUnreadData<utility::StandardInOutReflector>());
+	CHECK(LeavesUnreadData<utility::BinaryInOutReflector>());
+}
@@ -1,5 +1,6 @@
 #include <reflect/Class.h>
 #include <reflect/PrimitiveTypes.h>
+#include <reflect/string/Fragment.h>
 #include <reflect/test/Test.h>
 
 using namespace reflect;
@@ -85,3 +86,14 @@ TEST(Primitive)
 	CHECK_EQUAL(TypeOf<int>()->Name(), "int");
 	CHECK_EQUAL(TypeOf<float>()->Name(), "float");
 }
+
+TEST(FindTypeByHash)
+{
+	string::Fragment name("reflect::Type");
+
+	CHECK(Type::FindType(name, Type::HashName(name)) == TypeOf<Type>());
+	CHECK(Type::FindType("reflect::Type") == TypeOf<Type>());
+	CHECK_EQUAL(Type::HashName(name), TypeOf<Type>()->NameHash());
+	CHECK(Type::FindType(string::Fragment("reflect::Typ"), Type::HashName("reflect::Typ")) == NULL);
+	CHECK(Type::FindType("no such type") == NULL);
+}
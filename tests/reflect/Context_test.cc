@@ -0,0 +1,140 @@
+#include <reflect/string/StringPool.h>
+#include <reflect/utility/Context.hpp>
+#include <reflect/utility/Thread.h>
+#include <reflect/utility/Mutex.h>
+#include <reflect/test/Test.h>
+
+using namespace reflect;
+
+namespace {
+
+struct WorkerResult
+{
+	WorkerResult() : inherited(0), current(0), scoped(0), restored(0) {}
+
+	string::StringPoolContext *inherited;
+	string::StringPoolContext *current;
+	string::StringPoolContext *scoped;
+	string::StringPoolContext *restored;
+	string::SharedString shared;
+	string::SharedString local;
+};
+
+void Worker(void *data)
+{
+	WorkerResult &result = *static_cast<WorkerResult *>(data);
+	string::StringPoolContext::Inherit inherit(result.inherited);
+
+	result.current = string::StringPoolContext::GetContext();
+	result.shared = string::SharedString::Find("context test: shared");
+
+	{
+		string::StringPoolContext scope;
+		result.scoped = string::StringPoolContext::GetContext();
+		result.local = string::SharedString::Copy("context test: worker");
+	}
+
+	result.restored = string::StringPoolContext::GetContext();
+}
+
+// a context with no process wide instance.
+class LocalContext : public utility::Context<LocalContext>
+{
+};
+
+struct LocalWorker
+{
+	utility::Mutex *mutex;
+	int *constructed;
+	bool *release;
+	bool own;
+
+	bool Released()
+	{
+		utility::ScopedLock lock(*mutex);
+		return *release;
+	}
+};
+
+void ConstructLocal(void *data)
+{
+	LocalWorker &worker = *static_cast<LocalWorker *>(data);
+	LocalContext context;
+
+	{
+		utility::ScopedLock lock(*worker.mutex);
+		++*worker.constructed;
+	}
+
+	// hold the context while the other threads look.
+	while(false == worker.Released())
+		;
+
+	worker.own = LocalContext::GetContext() == &context;
+}
+
+}
+
+TEST(ThreadContexts)
+{
+	string::StringPoolContext scope;
+	string::SharedString shared = string::SharedString::Copy("context test: shared");
+
+	WorkerResult result;
+	result.inherited = &scope;
+
+	utility::Thread worker;
+	CHECK(worker.Start(&Worker, &result));
+	worker.Join();
+
+	// the worker ran in this thread's pool, and its own scope didn't leak here.
+	CHECK(result.current == &scope);
+	CHECK(result.shared == shared);
+	CHECK(result.scoped != 0 && result.scoped != &scope);
+	CHECK(result.local);
+	CHECK(result.restored == &scope);
+	CHECK(string::StringPoolContext::GetContext() == &scope);
+	CHECK(!string::SharedString::Find("context test: worker"));
+	CHECK(utility::Thread::HardwareConcurrency() >= 1);
+}
+
+TEST(ThreadLocalContexts)
+{
+	utility::Mutex mutex;
+	int constructed = 0;
+	bool release = false;
+
+	LocalWorker workers[2];
+	utility::Thread threads[2];
+
+	for(int index = 0; index < 2; index++)
+	{
+		LocalWorker &worker = workers[index];
+		worker.mutex = &mutex;
+		worker.constructed = &constructed;
+		worker.release = &release;
+		worker.own = false;
+		CHECK(threads[index].Start(&ConstructLocal, &worker));
+	}
+
+	for(bool waiting = true; waiting; )
+	{
+		utility::ScopedLock lock(mutex);
+		waiting = constructed < 2;
+	}
+
+	// neither worker's context became current here.
+	CHECK(LocalContext::GetContext() == 0);
+
+	{
+		utility::ScopedLock lock(mutex);
+		release = true;
+	}
+
+	threads[0].Join();
+	threads[1].Join();
+
+	CHECK(workers[0].own);
+	CHECK(workers[1].own);
+	CHECK(LocalContext::GetContext() == 0);
+}
@@ -0,0 +1,82 @@
+#include <reflect/Persistent.h>
+#include <reflect/string/String.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/utility/InOutReflector.h>
+#include <reflect/BufferedInputStream.h>
+#include <reflect/test/Test.h>
+
+using namespace reflect;
+
+class view_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	string::Fragment plain;
+	string::Fragment view;
+	string::Fragment escaped;
+};
+
+DEFINE_REFLECTION(view_tester, "reflect_test::view_tester")
+{
+	+ Concrete;
+
+	Properties
+		("plain", &view_tester::plain)
+		("view", &view_tester::view, View)
+		("escaped", &view_tester::escaped, View)
+		;
+}
+
+template<typename SerializerType, typename DeserializerType>
+static bool LoadsViews()
+{
+	view_tester x;
+	x.plain = "plain";
+	x.view = "pointing into the input";
+	x.escaped = "needs \"escaping\" in text";
+
+	utility::InOutReflector<SerializerType, DeserializerType> out;
+	out << x;
+
+	const string::String &data = out.Data();
+	BufferedInputStream input(data.data(), data.size());
+	DeserializerType deserializer(input);
+	Reflector reflector(deserializer);
+
+	view_tester copy;
+	reflector | copy;
+
+	const char *begin = data.data(), *end = begin + data.size();
+
+	return reflector.Ok()
+		&& copy.plain == x.plain
+		&& copy.view == x.view
+		&& copy.escaped == x.escaped
+		&& (copy.plain.data() < begin || copy.plain.data() >= end)
+		&& copy.view.data() >= begin && copy.view.data() < end;
+}
+
+TEST(FragmentViews)
+{
+	CHECK((LoadsViews<serialize::StandardSerializer, serialize::StandardDeserializer>()));
+	CHECK((LoadsViews<serialize::BinarySerializer, serialize::BinaryDeserializer>()));
+}
+
+TEST(FragmentViewFallback)
+{
+	const char text[] = "  \"needs \\\"escaping\\\"\"";
+	BufferedInputStream input(text, sizeof(text) - 1);
+	serialize::StandardDeserializer deserializer(input);
+	Deserializer &base = deserializer;
+	string::Fragment view;
+
+	// nothing is consumed when the text can't be viewed.
+	CHECK(!base.DeserializeTextView(view));
+	CHECK(input.Window() == text);
+
+	Reflector reflector(deserializer);
+	string::Fragment copy;
+	reflector | copy;
+	CHECK(reflector.Ok());
+	CHECK(copy == "needs \"escaping\"");
+}
@@ -56,3 +56,100 @@ TEST(FunctionStuff)
 	fragment.SetValue("abc");
 	CHECK_EQUAL("\"abc\"", fragment.ToString());
 }
+
+int NativeSum7(int a, int b, int c, int d, int e, int f, int g)
+{
+	return a + b + c + d + e + f + g;
+}
+
+TEST(ReusedParameters)
+{
+	using namespace reflect;
+
+	// one list, called repeatedly with new values.
+	const function::Function *add = function::CreateFunction("+", &NativeAdd);
+	function::Parameters params(add);
+	int total = 0, result = 0;
+	Variant total_ref = Variant::FromRef(total);
+	Variant result_ref = Variant::FromRef(result);
+
+	for(int i = 1; i <= 10; i++)
+	{
+		params.ref(total_ref).value(i);
+		CHECK(add->Call(params, result_ref));
+		total = result;
+	}
+
+	CHECK_EQUAL(55, total);
+
+	// more parameters than are stored inline.
+	const function::Function *sum = function::CreateFunction("sum", &NativeSum7);
+	function::Parameters many(sum);
+	many.value(1).value(2).value(3).value(4).value(5).value(6).value(7);
+	CHECK(sum->Call(many, result_ref));
+	CHECK_EQUAL(28, result);
+
+	// a const value can't be passed by reference.
+	int constant = 3;
+	Variant constant_ref = Variant::FromConstRef(constant);
+	params.const_ref(constant_ref).value(1);
+	CHECK(!add->Call(params, result_ref));
+}
+
+struct invoke_point
+{
+	invoke_point() : x(0) {}
+
+	double Scaled(int by, float offset) const { return x * by + offset; }
+	void Move(int &steps) { x += steps; steps = 0; }
+
+	int x;
+};
+
+DEFINE_LOCAL_STATIC_REFLECTION(invoke_point, reflect::Type, "reflect::test::invoke_point")
+{
+}
+
+TEST(TypedInvoke)
+{
+	ASSOCIATE(invoke_point);
+
+	using namespace reflect;
+
+	invoke_point point;
+	point.x = 3;
+
+	const function::Function *scaled = function::CreateFunction("Scaled", &invoke_point::Scaled);
+	const function::Function *move = function::CreateFunction("Move", &invoke_point::Move);
+	const function::Function *add = function::CreateFunction("+", &NativeAdd);
+
+	function::Invoker<double (int, float)> scale(scaled);
+	CHECK(scale.Valid());
+	CHECK_EQUAL(6.5, scale(&point, 2, 0.5f));
+	CHECK_EQUAL(3.25, scaled->Invoke<double (int, float)>()(&point, 1, 0.25f));
+
+	// a const object calls const methods only.
+	const invoke_point &const_point = point;
+	CHECK_EQUAL(9.0, scale(&const_point, 3, 0.f));
+
+	function::Invoker<void (int &)> mover(move);
+	int steps = 4;
+	CHECK(mover.Valid());
+	mover(&point, steps);
+	CHECK_EQUAL(7, point.x);
+	CHECK_EQUAL(0, steps);
+
+	// signatures must match the function's.
+	CHECK(!(function::Invoker<double (int, double)>(scaled).Valid()));
+	CHECK(!(function::Invoker<int (int, float)>(scaled).Valid()));
+	CHECK(!(function::Invoker<void (int)>(move).Valid()));
+	CHECK(!(function::Invoker<void (int &, int)>(scaled).Valid()));
+
+	// functions without "this", mutable parameters may take by value arguments.
+	function::Invoker<int (int &, int)> adder(add);
+	int i = 5;
+	CHECK(adder.Valid());
+	CHECK_EQUAL(12, adder(i, 7));
+	CHECK(function::Invoker<void (int &, const int &)>(add).Valid());
+	CHECK(!(function::Invoker<int (int, int)>(add).Valid()));
+}
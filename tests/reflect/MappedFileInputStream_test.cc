@@ -0,0 +1,112 @@
+#include <reflect/Persistent.h>
+#include <reflect/string/String.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/utility/SaveLoad.h>
+#include <reflect/utility/MappedFileInputStream.h>
+#include <reflect/test/Test.h>
+
+#include <vector>
+#include <cstdio>
+
+using namespace reflect;
+
+class mapped_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	mapped_tester() : number(0), link(0) {}
+
+	int number;
+	string::String text;
+	std::vector<int> values;
+	string::Fragment view;
+	mapped_tester *link;
+};
+
+DEFINE_REFLECTION(mapped_tester, "reflect_test::mapped_tester")
+{
+	+ Concrete;
+
+	Properties
+		("number", &mapped_tester::number)
+		("text", &mapped_tester::text)
+		("values", &mapped_tester::values, Array)
+		("view", &mapped_tester::view, View)
+		("link", &mapped_tester::link)
+		;
+}
+
+static void FillMappedTester(mapped_tester &x)
+{
+	x.number = -123456;
+	x.text = "a string which is quite a bit longer than the sixty-three bytes read per chunk";
+	x.values.push_back(0);
+	x.values.push_back(1 << 30);
+	x.link = &x;
+}
+
+static bool SameMappedTester(const mapped_tester &x, const mapped_tester &copy)
+{
+	return x.number == copy.number
+		&& x.text == copy.text
+		&& x.values == copy.values
+		&& copy.link == &copy;
+}
+
+TEST(MappedFile)
+{
+	mapped_tester x;
+	FillMappedTester(x);
+
+	const char *filename = "mapped_test.tmp";
+
+	mapped_tester *text_copy = 0, *binary_copy = 0;
+	CHECK(utility::SaveFile(&x, filename));
+	{
+		utility::MappedFileInputStream input(filename);
+		CHECK(input.IsOpen() && input.Resident());
+		CHECK(utility::LoadMappedFile(text_copy, input));
+	}
+	CHECK(utility::SaveBinaryFile(&x, filename));
+	{
+		utility::MappedFileInputStream input(filename);
+		CHECK(utility::LoadMappedBinaryFile(binary_copy, input));
+	}
+	std::remove(filename);
+
+	CHECK(text_copy && SameMappedTester(x, *text_copy));
+	CHECK(binary_copy && SameMappedTester(x, *binary_copy));
+	delete text_copy;
+	delete binary_copy;
+
+	mapped_tester missing_copy;
+	utility::MappedFileInputStream missing("no such file");
+	CHECK(!missing.IsOpen());
+	CHECK_EQUAL(false, utility::LoadMappedFile(missing_copy, missing));
+}
+
+TEST(MappedFileViews)
+{
+	mapped_tester x;
+	x.view = "pointing into the mapping";
+
+	const char *text_filename = "mapped_views.tmp";
+	const char *binary_filename = "mapped_binary_views.tmp";
+
+	mapped_tester text_copy, binary_copy;
+	CHECK(utility::SaveFile(x, text_filename));
+	CHECK(utility::SaveBinaryFile(x, binary_filename));
+	{
+		utility::MappedFileInputStream text_input(text_filename);
+		utility::MappedFileInputStream binary_input(binary_filename);
+
+		// the views stay valid for as long as their mappings.
+		CHECK(utility::LoadMappedFile(text_copy, text_input));
+		CHECK(utility::LoadMappedBinaryFile(binary_copy, binary_input));
+		CHECK(text_copy.view == x.view);
+		CHECK(binary_copy.view == x.view);
+	}
+
+	std::remove(text_filename);
+	std::remove(binary_filename);
+}
@@ -0,0 +1,127 @@
+#include <reflect/serialize/NumberFormat.h>
+#include <reflect/utility/InOutReflector.h>
+#include <reflect/string/String.h>
+#include <reflect/PrimitiveTypes.h>
+#include <reflect/test/Test.h>
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+using namespace reflect;
+
+static bool FormatsAs(double value, const char *text)
+{
+	char buffer[serialize::MaxNumberLength];
+	unsigned size = serialize::FormatDouble(buffer, value);
+	return string::Fragment(buffer, size) == string::Fragment(text);
+}
+
+static bool RoundTrips(double value)
+{
+	char buffer[serialize::MaxNumberLength];
+	unsigned size = serialize::FormatDouble(buffer, value);
+	double copy = 0;
+	return serialize::ParseDouble(buffer, size, copy) && copy == value;
+}
+
+TEST(NumberFormatDoubles)
+{
+	CHECK(FormatsAs(3, "3"));
+	CHECK(FormatsAs(-42, "-42"));
+	CHECK(FormatsAs(0.1, "0.1"));
+	CHECK(FormatsAs(1.5e-7, "1.5e-07"));
+	CHECK(FormatsAs(1e100, "1e+100"));
+	CHECK(FormatsAs(0.1 + 0.2, "0.30000000000000004"));
+	CHECK(FormatsAs(-0.0, "-0"));
+	CHECK(FormatsAs(1e-5, "1e-05"));
+	CHECK(FormatsAs(1e23, "1e+23"));
+	CHECK(FormatsAs(123456.789, "123456.789"));
+	CHECK(FormatsAs(1234567890123456.7, "1234567890123456.8"));
+	CHECK(FormatsAs(0.000123, "0.000123"));
+	CHECK(FormatsAs(5e-324, "5e-324"));
+
+	CHECK(RoundTrips(1.0 / 3));
+	CHECK(RoundTrips(2.2250738585072014e-308));
+	CHECK(RoundTrips(1.7976931348623157e308));
+	CHECK(RoundTrips(4.9406564584124654e-324));
+
+	std::srand(17);
+	bool all = true;
+	for(int i = 0; i < 1000; i++)
+	{
+		double value = (double(std::rand()) / RAND_MAX - 0.5) * std::rand();
+		all = all && RoundTrips(value) && RoundTrips(1 / value);
+	}
+	CHECK(all);
+
+	// arbitrary bit patterns, denormals included.
+	unsigned long long bits = 88172645463325252ull;
+	for(int i = 0; i < 10000; i++)
+	{
+		bits ^= bits << 13;
+		bits ^= bits >> 7;
+		bits ^= bits << 17;
+
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		all = all && (value != value || RoundTrips(value));
+	}
+	CHECK(all);
+
+	double value = 0;
+	CHECK(serialize::ParseDouble("12.5e2", 6, value));
+	CHECK_EQUAL(1250.0, value);
+	CHECK(serialize::ParseDouble("1234567890123456789", 19, value));
+	CHECK_EQUAL(1234567890123456789.0, value);
+	CHECK_EQUAL(false, serialize::ParseDouble("1.5x", 4, value));
+	CHECK_EQUAL(false, serialize::ParseDouble("", 0, value));
+}
+
+TEST(NumberFormatIntegers)
+{
+	char buffer[serialize::MaxNumberLength];
+	long value = 0;
+	unsigned long uvalue = 0;
+
+	unsigned size = serialize::FormatSigned(buffer, LONG_MIN);
+	CHECK(serialize::ParseSigned(buffer, size, value));
+	CHECK_EQUAL(LONG_MIN, value);
+
+	size = serialize::FormatHex(buffer, ULONG_MAX);
+	CHECK(serialize::ParseUnsigned(buffer, size, uvalue));
+	CHECK_EQUAL(ULONG_MAX, uvalue);
+
+	CHECK(string::Fragment(buffer, serialize::FormatHex(buffer, 32ul)) == "0x20");
+	CHECK(string::Fragment(buffer, serialize::FormatSigned(buffer, -1203)) == "-1203");
+
+	// octal and signs are still read like strtol.
+	CHECK(serialize::ParseSigned("010", 3, value));
+	CHECK_EQUAL(8, value);
+	CHECK(serialize::ParseSigned("+0x1f", 5, value));
+	CHECK_EQUAL(31, value);
+	CHECK_EQUAL(false, serialize::ParseSigned("12a", 3, value));
+	CHECK_EQUAL(false, serialize::ParseUnsigned("0x", 2, uvalue));
+}
+
+TEST(NumberFormatText)
+{
+	utility::StandardInOutReflector reflector;
+
+	reflector << 0.1 << -2.5e-300 << 1e21 << long(-7) << 9ul;
+
+	double d;
+	long i;
+	unsigned long u;
+
+	reflector >> d;
+	CHECK_EQUAL(0.1, d);
+	reflector >> d;
+	CHECK_EQUAL(-2.5e-300, d);
+	reflector >> d;
+	CHECK_EQUAL(1e21, d);
+	reflector >> i >> u;
+	CHECK_EQUAL(-7, i);
+	CHECK_EQUAL(9ul, u);
+	CHECK(reflector.Ok());
+}
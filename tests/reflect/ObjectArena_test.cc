@@ -0,0 +1,80 @@
+#include <reflect/Persistent.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/ObjectArena.h>
+#include <reflect/BufferedInputStream.h>
+#include <reflect/serialize/StandardSerializer.h>
+#include <reflect/serialize/StandardDeserializer.h>
+#include <reflect/string/StringOutputStream.h>
+#include <reflect/test/Test.h>
+
+#include <cstddef>
+
+using namespace reflect;
+
+class arena_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	arena_tester() : number(0), link(0) {}
+
+	int number;
+	arena_tester *link;
+};
+
+DEFINE_REFLECTION(arena_tester, "reflect_test::arena_tester")
+{
+	+ Concrete;
+
+	Properties
+		("number", &arena_tester::number)
+		("link", &arena_tester::link)
+		;
+}
+
+TEST(ArenaDeserialization)
+{
+	arena_tester chain[4];
+
+	for(int i = 0; i < 4; i++)
+	{
+		chain[i].number = i;
+		chain[i].link = i < 3 ? &chain[i + 1] : 0;
+	}
+
+	string::StringOutputStream stream;
+	{
+		serialize::StandardSerializer serializer(stream);
+		Reflector reflector(serializer);
+		reflector | chain[0];
+		CHECK(reflector.Ok());
+	}
+
+	const string::String &text = stream.Result();
+
+	ObjectArena arena(256);
+	BufferedInputStream input(text.data(), text.size());
+	serialize::StandardDeserializer deserializer(input);
+	deserializer.SetArena(&arena);
+	Reflector reflector(deserializer);
+
+	arena_tester copy;
+	reflector | copy;
+	CHECK(reflector.Ok());
+	CHECK_EQUAL(3u, unsigned(arena.Objects()));
+
+	int count = 0;
+
+	for(arena_tester *link = &copy; link; link = link->link, count++)
+		CHECK_EQUAL(count, link->number);
+
+	CHECK_EQUAL(4, count);
+
+	// the linked objects belong to the arena.
+	arena.Release();
+	CHECK_EQUAL(0u, unsigned(arena.Objects()));
+
+	void *big = arena.Allocate(1000, 64);
+	void *small = arena.Allocate(8, 16);
+	CHECK(big && (reinterpret_cast<std::size_t>(big) & 63) == 0);
+	CHECK(small && (reinterpret_cast<std::size_t>(small) & 15) == 0);
+}
@@ -0,0 +1,104 @@
+#include <reflect/Persistent.h>
+#include <reflect/string/String.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/BufferedInputStream.h>
+#include <reflect/serialize/BinarySerializer.h>
+#include <reflect/serialize/BinaryDeserializer.h>
+#include <reflect/serialize/ParallelBinarySerializer.h>
+#include <reflect/string/StringOutputStream.h>
+#include <reflect/test/Test.h>
+
+using namespace reflect;
+
+class parallel_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	parallel_tester() : number(0), link(0) {}
+
+	int number;
+	string::String text;
+	parallel_tester *link;
+};
+
+DEFINE_REFLECTION(parallel_tester, "reflect_test::parallel_tester")
+{
+	+ Concrete;
+
+	Properties
+		("number", &parallel_tester::number)
+		("text", &parallel_tester::text)
+		("link", &parallel_tester::link)
+		;
+}
+
+TEST(ParallelRoots)
+{
+	parallel_tester a, b, shared, alone;
+	a.number = 1;
+	b.number = 2;
+	shared.number = 3;
+	alone.number = 4;
+	shared.text = "shared";
+	a.link = &shared;
+	b.link = &shared;
+	shared.link = &a;
+	alone.link = &alone;
+
+	const Dynamic *roots[] = { &a, &b, &shared, 0, &alone };
+	const unsigned count = sizeof(roots) / sizeof(roots[0]);
+
+	string::StringOutputStream sequential;
+	{
+		serialize::BinarySerializer serializer(sequential);
+		Serializer &out = serializer;
+
+		for(unsigned index = 0; index < count; index++)
+			CHECK(out.Serialize(roots[index]));
+	}
+
+	string::StringOutputStream parallel;
+	serialize::ParallelBinarySerializer serializer(parallel, 3);
+
+	for(unsigned index = 0; index < count; index++)
+		serializer.Add(roots[index]);
+
+	CHECK(serializer.Run());
+
+	// references are renumbered as if the roots were written in turn.
+	const string::String &data = parallel.Result();
+	const string::String &expected = sequential.Result();
+	CHECK(string::Fragment(data.data(), data.size()) == string::Fragment(expected.data(), expected.size()));
+
+	BufferedInputStream input(data.data(), data.size());
+	serialize::BinaryDeserializer deserializer(input);
+	Deserializer &in = deserializer;
+
+	Dynamic *copies[count];
+
+	for(unsigned index = 0; index < count; index++)
+		CHECK(in.Deserialize(copies[index]));
+
+	parallel_tester *a_copy = copies[0] % autocast;
+	parallel_tester *b_copy = copies[1] % autocast;
+	parallel_tester *shared_copy = copies[2] % autocast;
+	parallel_tester *alone_copy = copies[4] % autocast;
+
+	CHECK(a_copy && b_copy && shared_copy && alone_copy);
+	CHECK(0 == copies[3]);
+
+	if(a_copy && b_copy && shared_copy && alone_copy)
+	{
+		CHECK(a_copy->link == shared_copy);
+		CHECK(b_copy->link == shared_copy);
+		CHECK(shared_copy->link == a_copy);
+		CHECK(alone_copy->link == alone_copy);
+		CHECK(shared_copy->text == shared.text);
+		CHECK_EQUAL(4, alone_copy->number);
+	}
+
+	delete a_copy;
+	delete b_copy;
+	delete shared_copy;
+	delete alone_copy;
+}
@@ -0,0 +1,60 @@
+#include <reflect/Persistent.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/SerializationTag.h>
+#include <reflect/utility/InOutReflector.h>
+#include <reflect/test/Test.h>
+
+using namespace reflect;
+
+class plan_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	plan_tester() : number(0), real(0), flag(false) {}
+
+	int number;
+	double real;
+	bool flag;
+};
+
+DEFINE_REFLECTION(plan_tester, "reflect_test::plan_tester")
+{
+	+ Concrete;
+
+	Properties
+		("number", &plan_tester::number)
+		("real", &plan_tester::real)
+		("flag", &plan_tester::flag)
+		;
+}
+
+TEST(PropertiesOutOfOrder)
+{
+	utility::BinaryInOutReflector reflector;
+	Serializer &out = reflector.GetSerializer();
+
+	SerializationTag item("", SerializationTag::ItemTag);
+	SerializationTag real("real", SerializationTag::PropertyTag);
+	SerializationTag number("number", SerializationTag::PropertyTag);
+	SerializationTag flag("flag", SerializationTag::PropertyTag);
+
+	out.Begin(item);
+	out.Begin(real);
+	out.Serialize(2.5);
+	out.End(real);
+	out.Begin(number);
+	out.Serialize(long(42));
+	out.End(number);
+	out.Begin(flag);
+	out.Serialize(true);
+	out.End(flag);
+	out.End(item);
+
+	plan_tester copy;
+	reflector >> copy;
+
+	CHECK(reflector.Ok());
+	CHECK_EQUAL(2.5, copy.real);
+	CHECK_EQUAL(42, copy.number);
+	CHECK_EQUAL(true, copy.flag);
+}
@@ -0,0 +1,70 @@
+#include <reflect/utility/PointerMap.hpp>
+#include <reflect/test/Test.h>
+#include <reflect/PrimitiveTypes.h>
+
+#include <vector>
+
+using namespace reflect;
+
+TEST(PointerMap)
+{
+	utility::PointerMap<int> map;
+	std::vector<int> objects(10000);
+
+	CHECK(map.Find(&objects[0]) == 0);
+
+	bool inserted = true;
+	for(unsigned i = 0; i < objects.size(); i++)
+		inserted = inserted && map.Insert(&objects[i], int(i));
+
+	CHECK(inserted);
+	CHECK_EQUAL(unsigned(objects.size()), unsigned(map.Size()));
+	CHECK_EQUAL(false, map.Insert(&objects[5], 0));
+
+	bool found = true;
+	for(unsigned i = 0; i < objects.size(); i++)
+		found = found && map.Find(&objects[i]) && *map.Find(&objects[i]) == int(i);
+
+	CHECK(found);
+
+	map.Clear();
+	CHECK_EQUAL(0u, unsigned(map.Size()));
+	CHECK(map.Find(&objects[5]) == 0);
+
+	map.Reserve(100);
+	CHECK(map.Insert(&objects[5], 5));
+	CHECK_EQUAL(5, *map.Find(&objects[5]));
+}
+
+TEST(PointerMapRemove)
+{
+	utility::PointerMap<int> map;
+	std::vector<int> objects(5000);
+
+	// a small table, so probe sequences wrap and collide.
+	for(int round = 0; round < 4; round++)
+	{
+		for(unsigned i = 0; i < objects.size(); i++)
+			map.FindOrInsert(&objects[i], int(i)) += 0;
+
+		for(unsigned i = round % 2; i < objects.size(); i += 2)
+			map.Remove(&objects[i]);
+	}
+
+	CHECK_EQUAL(unsigned(objects.size() / 2), unsigned(map.Size()));
+	CHECK_EQUAL(false, map.Remove(&objects[1]));
+
+	bool found = true;
+	for(unsigned i = 0; i < objects.size(); i++)
+	{
+		const int *value = map.Find(&objects[i]);
+		found = found && (i % 2 ? value == 0 : value && *value == int(i));
+	}
+
+	CHECK(found);
+
+	CHECK_EQUAL(7, map.FindOrInsert(&objects[1], 7));
+	CHECK_EQUAL(7, map.FindOrInsert(&objects[1], 8));
+	CHECK(map.Remove(&objects[1]));
+	CHECK(map.Find(&objects[1]) == 0);
+}
@@ -5,6 +5,7 @@
 #include <reflect/StructType.hpp>
 #include <reflect/EnumType.hpp>
 #include <reflect/PropertyPath.h>
+#include <reflect/CompiledPropertyPath.h>
 #include <reflect/test/Test.h>
 #include <cstdio>
 
@@ -338,6 +339,22 @@ TEST(StringReadWrite)
 	CHECK(a.Property("string").Read() == "\"A Quote: \\\"\"");
 }
 
+TEST(LongStringReadWrite)
+{
+	PathTester a;
+	string::String text;
+
+	// longer than the chunks strings are deserialized in, with escapes on the boundaries.
+	for(int i = 0; i < 40; i++)
+		text += "\"quoted\"\n";
+
+	utility::StandardInOutReflector reflector;
+	reflector << text;
+	CHECK(a.Property("string").Write(reflector.Data()));
+	CHECK(a.string == text);
+	CHECK(a.Property("string").Read() == reflector.Data());
+}
+
 TEST(PropertyPath_Map)
 {
 	PathTester x;
@@ -522,3 +539,49 @@ TEST(Failures)
 	
 	CHECK_EQUAL("link tool tip", x.Property("link").Annotation("tooltip").AsValue<string::String>().c_str());
 }
+
+TEST(CompiledPath)
+{
+	PathTester a;
+	PathTester b;
+	a.links.push_back(&a);
+	a.links.push_back(&b);
+	a.link = &b;
+
+	CompiledPropertyPath path;
+	PropertyPath result;
+
+	CHECK(false == path.Compile("links[x]", TypeOf<PathTester>()));
+	CHECK(false == path.Compile("map{1", TypeOf<PathTester>()));
+
+	CHECK(path.Compile("links[1].map{3}", TypeOf<PathTester>()));
+	CHECK(path.Resolve(result, &a));
+	CHECK(result.WriteValue(7));
+	CHECK_EQUAL(7, b.map[3]);
+
+	// the same program applies to any object of the class.
+	b.links.push_back(&a);
+	b.links.push_back(&a);
+	CHECK(path.Resolve(result, &b));
+	CHECK(result.Write("8"));
+	CHECK_EQUAL(8, a.map[3]);
+
+	CHECK(path.Compile("link.data", TypeOf<PathTester>()));
+	b.data.push_back(5);
+	CHECK(path.Resolve(result, static_cast<const PathTester *>(&a)));
+	CHECK(result.IsArray());
+	CHECK_EQUAL(1u, result.ArraySize());
+
+	CHECK(path.Compile("link", TypeOf<PathTester>()));
+	CHECK(path.Resolve(result, &a));
+	CHECK_EQUAL("link tool tip", result.Annotation("tooltip").AsValue<string::String>().c_str());
+
+	CHECK(path.Compile("nothing", TypeOf<PathTester>()));
+	CHECK(false == path.Resolve(result, &a));
+	CHECK(false == path.Resolve(result, static_cast<PathTester *>(0)));
+
+	// compiled for another class, resolved by name.
+	CHECK(path.Compile("data", TypeOf<Persistent>()));
+	CHECK(path.Resolve(result, &b));
+	CHECK(result.ArrayItem(0).ReadValue<int>() == 5);
+}
@@ -0,0 +1,112 @@
+#include <reflect/Persistent.h>
+#include <reflect/string/String.h>
+#include <reflect/PersistentClass.hpp>
+#include <reflect/BufferedInputStream.h>
+#include <reflect/serialize/StandardSerializer.h>
+#include <reflect/serialize/StandardDeserializer.h>
+#include <reflect/string/StringOutputStream.h>
+#include <reflect/test/Test.h>
+
+using namespace reflect;
+
+class text_tester : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	text_tester() : number(0), link(0) {}
+
+	int number;
+	string::String text;
+	text_tester *link;
+};
+
+DEFINE_REFLECTION(text_tester, "reflect_test::text_tester")
+{
+	+ Concrete;
+
+	Properties
+		("number", &text_tester::number)
+		("text", &text_tester::text)
+		("link", &text_tester::link)
+		;
+}
+
+static bool WritesChain(string::String &text, bool name_table)
+{
+	text_tester chain[4];
+
+	for(int i = 0; i < 4; i++)
+	{
+		chain[i].number = i;
+		chain[i].text = "chained";
+		chain[i].link = i < 3 ? &chain[i + 1] : 0;
+	}
+
+	string::StringOutputStream stream;
+	serialize::StandardSerializer serializer(stream, name_table);
+	Reflector reflector(serializer);
+	reflector | chain[0];
+	text = stream.Result();
+
+	return reflector.Ok();
+}
+
+TEST(TextNameTable)
+{
+	string::String plain, table;
+	CHECK(WritesChain(plain, false));
+	CHECK(WritesChain(table, true));
+	CHECK(table.size() < plain.size());
+
+	BufferedInputStream input(table.data(), table.size());
+	serialize::StandardDeserializer deserializer(input);
+	Reflector reflector(deserializer);
+
+	text_tester copy;
+	reflector | copy;
+	CHECK(reflector.Ok());
+
+	int count = 0;
+
+	for(text_tester *link = &copy; link; link = link->link, count++)
+	{
+		CHECK_EQUAL(count, link->number);
+		CHECK(link->text == "chained");
+	}
+
+	CHECK_EQUAL(4, count);
+
+	while(text_tester *link = copy.link)
+	{
+		copy.link = link->link;
+		link->link = 0;
+		delete link;
+	}
+}
+
+TEST(TextNameTableSkipsUnknown)
+{
+	// the unknown property defines the class name and "number",
+	// which the link refers to by offset.
+	const char text[] =
+		"{ $+bogus= #+reflect_test::text_tester @0 $+number=5; ;"
+		" $*32=3;"
+		" $+link= #*6 @1 $*32=4; ;"
+		" }";
+	BufferedInputStream input(text, sizeof(text) - 1);
+	serialize::StandardDeserializer deserializer(input);
+	Reflector reflector(deserializer);
+
+	text_tester copy;
+	reflector | copy;
+	CHECK(reflector.Ok());
+	CHECK_EQUAL(3, copy.number);
+	CHECK(copy.link != 0);
+
+	if(copy.link)
+	{
+		CHECK_EQUAL(4, copy.link->number);
+		delete copy.link;
+		copy.link = 0;
+	}
+}
@@ -0,0 +1,119 @@
+#include <reflect/string/StringPool.h>
+#include <reflect/string/String.h>
+#include <reflect/utility/Thread.h>
+#include <reflect/test/Test.h>
+
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+using namespace reflect;
+
+TEST(StringPool)
+{
+	string::StringPool parent;
+	string::StringPool pool(&parent);
+
+	string::SharedString inherited = parent.Copy("inherited");
+	CHECK(pool.Find("inherited") == inherited);
+	CHECK(pool.Copy("inherited") == inherited);
+	CHECK(!pool.Find("missing"));
+	CHECK(!parent.Find("missing"));
+
+	const char *literal = "a literal";
+	CHECK(pool.Literal(literal).data() == literal);
+	CHECK(pool.Copy("a literal").data() == literal);
+
+	std::vector<string::SharedString> strings;
+	string::String text;
+
+	for(int i = 0; i < 5000; i++)
+	{
+		text.format("string %d", i);
+		strings.push_back(pool.Copy(text));
+	}
+
+	// a long string gets a chunk of its own.
+	text = "";
+	for(int i = 0; i < 200; i++)
+		text += "long ";
+
+	string::SharedString long_string = pool.Copy(text);
+
+	bool stable = true;
+	for(int i = 0; i < 5000; i++)
+	{
+		text.format("string %d", i);
+		stable = stable && pool.Find(text) == strings[i] && pool.Copy(text) == strings[i];
+		stable = stable && text == strings[i].c_str();
+	}
+
+	CHECK(stable);
+	CHECK(long_string.data() == pool.Find(string::Fragment(long_string)).data());
+	CHECK(!parent.Find("string 7"));
+}
+
+namespace {
+
+const int SharedCount = 2000;
+
+struct Interner
+{
+	string::StringPool *pool;
+	int offset;
+	std::vector<const char *> interned;
+};
+
+void InternShared(void *argument)
+{
+	Interner &self = *static_cast<Interner *>(argument);
+	char text[32];
+
+	self.interned.resize(SharedCount);
+
+	// every thread interns the same strings, each starting somewhere else.
+	for(int i = 0; i < SharedCount; i++)
+	{
+		int index = (i + self.offset) % SharedCount;
+		std::sprintf(text, "shared %d", index);
+		self.interned[index] = self.pool->Copy(text).data();
+	}
+}
+
+}
+
+TEST(StringPoolThreads)
+{
+	const int threads = 4;
+
+	string::StringPool pool;
+	Interner interners[threads];
+	utility::Thread workers[threads];
+
+	for(int t = 0; t < threads; t++)
+	{
+		interners[t].pool = &pool;
+		interners[t].offset = t * SharedCount / threads;
+	}
+
+	for(int t = 0; t < threads; t++)
+		CHECK(workers[t].Start(&InternShared, &interners[t]));
+
+	for(int t = 0; t < threads; t++)
+		workers[t].Join();
+
+	bool identical = true;
+	char text[32];
+
+	for(int i = 0; i < SharedCount; i++)
+	{
+		std::sprintf(text, "shared %d", i);
+		const char *found = pool.Find(text).data();
+		identical = identical && found && 0 == std::strcmp(found, text);
+
+		for(int t = 0; t < threads; t++)
+			identical = identical && interners[t].interned[i] == found;
+	}
+
+	CHECK(identical);
+}
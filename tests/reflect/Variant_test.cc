@@ -4,10 +4,13 @@
 #include <reflect/Reflection.h>
 #include <reflect/config/ReflectExport.h>
 #include <reflect/Type.hpp>
+#include <reflect/utility/InOutReflector.h>
 
 #include <reflect/string/String.h>
 #include <reflect/string/Fragment.h>
 
+#include <vector>
+
 using namespace reflect;
 
 struct DeletionChecker
@@ -99,3 +102,111 @@ TEST(VariantCasting)
 
 	CHECK_EQUAL("Bye", str);
 }
+
+TEST(VariantSmallValues)
+{
+	Variant copy;
+
+	{
+		Variant value = Variant::FromValue(42);
+		copy = value;
+		CHECK(value.Opaque() != copy.Opaque());
+		CHECK(value.AsValue<int>() == 42);
+	}
+
+	CHECK_EQUAL(42, copy.AsValue<int>());
+
+	// copies of small values are independent, copies of other values share.
+	Variant small = Variant::FromValue(1);
+	Variant small_copy(small);
+	small_copy.AsRef<int>() = 2;
+	CHECK_EQUAL(1, small.AsValue<int>());
+
+	Variant shared;
+	shared.BindType<DeletionChecker>();
+	CHECK(shared.Construct());
+	Variant shared_copy(shared);
+	CHECK(shared.Opaque() == shared_copy.Opaque());
+
+	// a reference keeps the value alive, as with allocated values.
+	Variant ref;
+
+	{
+		Variant value = Variant::FromValue(2.5);
+		CHECK(ref.Ref(value));
+		value.AsRef<double>() = 3.5;
+	}
+
+	CHECK_EQUAL(3.5, ref.AsValue<double>());
+
+	Variant text = Variant::FromConstRef("literal");
+	Variant text_copy = text;
+	CHECK_EQUAL(string::String("literal"), text_copy.AsValue<string::String>());
+
+	Variant string_value = Variant::FromValue(string::String("a string"));
+	Variant string_copy = string_value;
+	CHECK_EQUAL(string::String("a string"), string_copy.AsValue<string::String>());
+}
+
+TEST(VariantSharing)
+{
+	bool deleted = false;
+	Variant const_ref;
+
+	{
+		Variant variant;
+		variant.BindType<DeletionChecker>();
+		CHECK(variant.Construct());
+		variant.AsRef<DeletionChecker>().deleted = &deleted;
+
+		std::vector<Variant> copies(100, variant);
+		CHECK(const_ref.ConstRef(variant));
+	}
+
+	// the last holder destroys the value, even a const reference.
+	CHECK(!deleted);
+	const_ref = Variant();
+	CHECK(deleted);
+
+	Variant a = Variant::FromValue(1), b = Variant::FromValue(string::String("two"));
+	a.Swap(b);
+	CHECK(a.GetType() == TypeOf<string::String>());
+	CHECK_EQUAL(1, b.AsValue<int>());
+}
+
+template<typename T>
+static bool FormatsLikeSerializer(const T &value)
+{
+	Variant variant = Variant::FromValue(value);
+
+	utility::InOutReflector<> io;
+	Reflector reflector(io.GetSerializer());
+	variant.Serialize(reflector);
+
+	Variant copy;
+	copy.BindType<T>();
+
+	return variant.ToString() == io.Data()
+		&& copy.FromString(io.Data())
+		&& copy.AsValue<T>() == value;
+}
+
+TEST(VariantTextConversions)
+{
+	CHECK(FormatsLikeSerializer(true));
+	CHECK(FormatsLikeSerializer(-12345));
+	CHECK(FormatsLikeSerializer(4000000000ul));
+	CHECK(FormatsLikeSerializer((unsigned char)200));
+	CHECK(FormatsLikeSerializer(0.1));
+	CHECK(FormatsLikeSerializer(2.5f));
+	CHECK(FormatsLikeSerializer(string::String("plain")));
+	CHECK(FormatsLikeSerializer(string::String("needs \"escaping\"\n")));
+
+	// space is skipped, anything else is left to the deserializer.
+	Variant number;
+	number.BindType<int>();
+	CHECK(number.FromString(" 42\n"));
+	CHECK_EQUAL(42, number.AsValue<int>());
+	CHECK(number.FromString("7;"));
+	CHECK_EQUAL(7, number.AsValue<int>());
+}
@@ -1,9 +1,13 @@
 #include <reflect/Persistent.h>
 #include <reflect/string/String.h>
 #include <reflect/PersistentClass.hpp>
+#include <reflect/ObjectType.hpp>
 #include <reflect/StructType.hpp>
 #include <reflect/EnumType.hpp>
 #include <reflect/PropertyPath.h>
+#include <reflect/PropertyAccessor.h>
+#include <reflect/ArrayProperty.h>
+#include <reflect/function/BatchCall.h>
 #include <reflect/test/Test.h>
 
 #include <vector>
@@ -35,6 +39,50 @@ DEFINE_REFLECTION(property_tester, "reflect_test::property_tester")
 		("accessor", &property_tester::read, &property_tester::write)
 		("variant", &property_tester::variant_read, &property_tester::variant_write, Variant)
 		;
+
+	Functions
+		("read", &property_tester::read)
+		("write", &property_tester::write)
+		;
+}
+
+class property_tester_child : public property_tester
+{
+	DECLARE_REFLECTION(property_tester)
+public:
+	int shadow;
+	int read_shadow() const { return shadow; }
+};
+
+DEFINE_REFLECTION(property_tester_child, "reflect_test::property_tester_child")
+{
+	Properties
+		("value", &property_tester_child::shadow)
+		;
+
+	Functions
+		("read", &property_tester_child::read_shadow)
+		;
+}
+
+class batch_owner : public Persistent
+{
+	DECLARE_REFLECTION(Persistent)
+public:
+	std::vector<property_tester *> items;
+	int calls;
+	int read_child(property_tester_child *child) { calls++; return child->shadow; }
+};
+
+DEFINE_REFLECTION(batch_owner, "reflect_test::batch_owner")
+{
+	Properties
+		("items", &batch_owner::items, Array)
+		;
+
+	Functions
+		("read_child", &batch_owner::read_child)
+		;
 }
 
 TEST(int_prop)
@@ -63,3 +111,132 @@ TEST(int_prop)
 	CHECK(test.Property("variant").Write("15"));
 	CHECK(test.Property("value").Read() == "15");
 }
+
+TEST(inherited_lookup)
+{
+	const PersistentClass *parent = TypeOf<property_tester>();
+	const PersistentClass *child = TypeOf<property_tester_child>();
+
+	CHECK(child->FindProperty("direct") == parent->FindProperty("direct"));
+	CHECK(child->FindProperty("value") != parent->FindProperty("value"));
+	CHECK(child->FindProperty("value") != 0);
+	CHECK(child->FindProperty("missing") == 0);
+
+	CHECK(child->FindFunction("write") == parent->FindFunction("write"));
+	CHECK(child->FindFunction("read") != parent->FindFunction("read"));
+	CHECK(child->FindFunction("read") != 0);
+
+	property_tester_child test;
+	test.value = 1;
+	test.shadow = 2;
+	CHECK(test.Property("value").Read() == "2");
+	CHECK(test.Property("accessor").Read() == "1");
+
+	// registering on the parent is seen through the child's table.
+	CHECK(child->FindFunction("direct_read") == 0);
+	TypeOf<property_tester>()->RegisterFunction("direct_read",
+		function::CreateFunction("direct_read", &property_tester::direct_read));
+	CHECK(child->FindFunction("direct_read") != 0);
+	CHECK(child->FindFunction("direct_read") == parent->FindFunction("direct_read"));
+}
+
+TEST(typed_accessors)
+{
+	const PersistentClass *clazz = TypeOf<property_tester>();
+	property_tester test;
+	Persistent *object = &test;
+
+	PropertyAccessor<int> value(clazz->FindProperty("value"));
+	PropertyAccessor<int> direct(clazz->FindProperty("direct"));
+	PropertyAccessor<int> accessor(clazz->FindProperty("accessor"));
+	PropertyAccessor<float> converted(clazz->FindProperty("value"));
+
+	CHECK(value.Valid() && value.Direct());
+	CHECK(direct.Valid() && direct.Direct());
+	CHECK(accessor.Valid() && !accessor.Direct());
+	CHECK(converted.Valid() && !converted.Direct());
+	CHECK(!PropertyAccessor<int>(0).Valid());
+
+	CHECK(value.Write(object, 21));
+	CHECK_EQUAL(21, test.value);
+	CHECK_EQUAL(21, direct.Get(object));
+	CHECK_EQUAL(21, accessor.Get(object));
+
+	CHECK(direct.Write(object, 22));
+	CHECK_EQUAL(22, value.Get(object));
+
+	CHECK(accessor.Write(object, 23));
+	CHECK_EQUAL(23, value.Get(object));
+
+	CHECK(converted.Write(object, 24.0f));
+	CHECK_EQUAL(24, test.value);
+	CHECK_EQUAL(24.0f, converted.Get(object));
+}
+
+TEST(batch_calls)
+{
+	const PersistentClass *clazz = TypeOf<property_tester>();
+	const function::Function *write = clazz->FindFunction("write");
+	const function::Function *read = clazz->FindFunction("read");
+
+	std::vector<property_tester> testers(100);
+	std::vector<void *> objects;
+	std::vector<int> values;
+
+	for(unsigned index = 0; index < testers.size(); index++)
+	{
+		objects.push_back(opaque_cast(&testers[index]));
+		values.push_back(int(index) * 3);
+	}
+
+	function::BatchCall writes(write);
+	CHECK(writes.Valid());
+	CHECK(!writes.Call(clazz, &objects[0], 100)); // no argument yet
+	CHECK(writes.Argument(0, &values[0]));
+	CHECK(writes.Call(clazz, &objects[0], 100, 3));
+	CHECK_EQUAL(297, testers[99].value);
+
+	// a constant, converted once per call from double.
+	CHECK(writes.Constant(0, 7.0));
+	CHECK(writes.Call(clazz, &objects[0], 50));
+	CHECK_EQUAL(7, testers[49].value);
+	CHECK_EQUAL(150, testers[50].value);
+
+	// the items of an array property, results converted to doubles.
+	property_tester_child child;
+	child.value = 11;
+	child.shadow = 0;
+
+	batch_owner owner;
+	owner.items.push_back(&testers[0]);
+	owner.items.push_back(&child);
+	owner.items.push_back(&testers[99]);
+
+	const ArrayProperty *items = TypeOf<batch_owner>()->FindProperty("items") % autocast;
+	std::vector<double> results(3);
+
+	function::BatchCall reads(read);
+	CHECK(reads.Results(&results[0]));
+	CHECK(reads.CallItems(items, opaque_cast(&owner), 2));
+	CHECK_EQUAL(7.0, results[0]);
+	CHECK_EQUAL(11.0, results[1]);
+	CHECK_EQUAL(297.0, results[2]);
+
+	// the wrong class of object.
+	CHECK(!writes.Call(TypeOf<batch_owner>(), &objects[0], 1));
+
+	// a column of pointers, one of which can't be passed as a child.
+	std::vector<int> shadows(3, -1);
+	std::vector<void *> owners(3, opaque_cast(&owner));
+	owner.calls = 0;
+	child.shadow = 5;
+
+	function::BatchCall read_children(TypeOf<batch_owner>()->FindFunction("read_child"));
+	CHECK(read_children.Argument(0, &owner.items[0]));
+	CHECK(read_children.Results(&shadows[0]));
+	CHECK(!read_children.Call(TypeOf<batch_owner>(), &owners[0], 3));
+	CHECK_EQUAL(1, owner.calls);
+	CHECK_EQUAL(-1, shadows[0]);
+	CHECK_EQUAL(5, shadows[1]);
+	CHECK_EQUAL(-1, shadows[2]);
+}